@@ -2,17 +2,12 @@
 #extension GL_EXT_nonuniform_qualifier : require      // for nonuniformEXT()
 #extension GL_EXT_samplerless_texture_functions : enable // sometimes required by toolchains; optional
 
-layout(push_constant) uniform PushConstant {
-    uvec4 data0;
-    uvec4 data1;
-    uvec4 data2;
-} pConst;
-
 layout(location = 0) in vec3 fragWorld;
 layout(location = 1) in vec3 fragNrml;
 layout(location = 2) in vec2 fragUV;
 layout(location = 3) in vec3 fragTangent;
 layout(location = 4) in vec4 fragColor;
+layout(location = 5) flat in uint fragMatIndex;
 
 struct Material {
     vec4 base;
@@ -52,7 +47,7 @@ void main() {
 
     lDot = mix(0.95, 1.0, lDot);
 
-    Material mat = materials[pConst.data0.w];
+    Material mat = materials[fragMatIndex];
 
     vec4 albColor = texColor(mat.tex1.x, fragUV);
     vec4 emissColor = texColor(mat.tex1.z, fragUV);
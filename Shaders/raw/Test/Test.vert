@@ -1,12 +1,22 @@
 #version 450
+#extension GL_ARB_shader_draw_parameters : require // gl_DrawIDARB
 
 layout(push_constant) uniform PushConstant {
+    uint drawBase; // First draw of this indirect call
+} pConst;
+
+struct DrawData {
     uvec4 data0;
     uvec4 data1;
     uvec4 data2;
-} pConst;
+};
 
-/* pConst explanation:
+// Per draw data, written by the drawable next to the indirect commands
+layout (std430, set = 6, binding = 0) readonly buffer DrawBuffer { DrawData draws[]; };
+
+DrawData drawData; // draws[drawBase + gl_DrawIDARB], set first thing in main()
+
+/* drawData explanation:
 
 data0 {
     .x = vertexFlag: {
@@ -38,16 +48,16 @@ data2 {
 
 */
 
-bool vHasSkin()  { return (pConst.data0.x & 1) != 0; }
-bool vHasMorph() { return (pConst.data0.x & 2) != 0; }
-bool vHasColor() { return (pConst.data0.x & 4) != 0; }
+bool vHasSkin()  { return (drawData.data0.x & 1) != 0; }
+bool vHasMorph() { return (drawData.data0.x & 2) != 0; }
+bool vHasColor() { return (drawData.data0.x & 4) != 0; }
 
-uint vertexCount() { return pConst.data0.y; }
+uint vertexCount() { return drawData.data0.y; }
 
-uint staticOffset()   { return pConst.data1.x; }
-uint rigOffset()      { return pConst.data1.y; }
-uint colorOffset()    { return pConst.data1.z; }
-uint mrphDltsOffset() { return pConst.data1.w; }
+uint staticOffset()   { return drawData.data1.x; }
+uint rigOffset()      { return drawData.data1.y; }
+uint colorOffset()    { return drawData.data1.z; }
+uint mrphDltsOffset() { return drawData.data1.w; }
 
 layout(location = 0) in vec4  inPos_Tu;
 layout(location = 1) in vec4  inNrml_Tv;
@@ -64,6 +74,7 @@ layout(location = 1) out vec3 fragNrml;
 layout(location = 2) out vec2 fragUV;
 layout(location = 3) out vec3 fragTangent;
 layout(location = 4) out vec4 fragColor;
+layout(location = 5) flat out uint fragMatIndex;
 
 layout(set = 0, binding = 0) uniform GlobalUBO {
     mat4 proj;
@@ -114,6 +125,9 @@ Mrph getMrphDlt(uint targetIndex) {
 }
 
 void main() {
+    drawData = draws[pConst.drawBase + gl_DrawIDARB];
+    fragMatIndex = drawData.data0.w;
+
     mat4 model = mat4(model4_0, model4_1, model4_2, model4_3);
 
     vec3 basePos     = inPos_Tu.xyz;
@@ -122,10 +136,10 @@ void main() {
 
 // ----------------------------------
 
-    uint vertexCount = pConst.data0.y;
+    uint vertexCount = drawData.data0.y;
     uint vertexIdx   = gl_VertexIndex;
 
-    uint mrphTargetCount = pConst.data0.z;
+    uint mrphTargetCount = drawData.data0.z;
 
     uint mrphWsCount = rtData.w;
     if (mrphWsCount > 0 && vertexCount > 0) {
@@ -0,0 +1,83 @@
+#include "bench.hpp"
+
+#include "ascPool.hpp"
+
+#include <cstdlib>
+
+/* Bulk emplace/erase: emplaceForN and erase(Span) against one call per element
+
+A batch of owned 128 B elements goes in and out of a pool already holding the rest. Between
+the timed emplace and erase, untimed filler is pushed behind the batch so the erase has to
+pull live elements down into the holes, like a subtree leaving a populated scene. The
+instantiate/subtree paths in Scene sit on these calls but need the whole runtime, so they
+are not timed here
+
+    batchBench [batch] [pool] [runs]
+*/
+
+namespace {
+
+struct Elem { // 128 B, a Transform3D-ish payload
+    float words[32];
+};
+
+struct Owner {};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t batch = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 10000;
+    uint32_t total = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 100000;
+    uint32_t runs  = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 50;
+    if (batch == 0 || batch > total) return 0;
+
+    Asc::Pool<Owner> owners;
+    std::vector<Asc::Handle> ownerHs(batch);
+    owners.emplaceN(Asc::Span<Asc::Handle>(ownerHs));
+
+    Asc::Pool<Elem> pool;
+    std::vector<Asc::Handle> base(total - batch);
+    pool.emplaceN(Asc::Span<Asc::Handle>(base));
+
+    std::vector<Asc::Handle> made(batch);
+    std::vector<Asc::Handle> filler(batch);
+
+    std::printf("%u owned %zu B elements in a %u pool, median of %u\n", batch, sizeof(Elem), total, runs);
+
+    // One round: timed emplace, untimed filler, timed erase, untimed filler erase
+    auto round = [&](bool bulk, std::vector<double>& inMs, std::vector<double>& outMs) {
+        auto t0 = std::chrono::steady_clock::now();
+        if (bulk) {
+            pool.emplaceForN(Asc::Span<const Asc::Handle>(ownerHs), Asc::Span<Asc::Handle>(made));
+        } else {
+            for (uint32_t i = 0; i < batch; ++i) made[i] = pool.emplaceFor(ownerHs[i]);
+        }
+        inMs.push_back(Bench::msSince(t0));
+
+        pool.emplaceN(Asc::Span<Asc::Handle>(filler));
+
+        t0 = std::chrono::steady_clock::now();
+        if (bulk) {
+            pool.erase(Asc::Span<const Asc::Handle>(made));
+        } else {
+            for (Asc::Handle h : made) pool.erase(h);
+        }
+        outMs.push_back(Bench::msSince(t0));
+
+        pool.erase(Asc::Span<const Asc::Handle>(filler));
+    };
+
+    std::vector<double> loopIn, loopOut, bulkIn, bulkOut;
+    for (uint32_t r = 0; r < runs; ++r) {
+        round(false, loopIn, loopOut);
+        round(true, bulkIn, bulkOut);
+    }
+
+    Bench::row("emplaceFor loop", Bench::median(loopIn));
+    Bench::row("emplaceForN", Bench::median(bulkIn));
+    Bench::row("erase(h) loop", Bench::median(loopOut));
+    Bench::row("erase(Span)", Bench::median(bulkOut));
+
+    Bench::keep(pool.count());
+    return 0;
+}
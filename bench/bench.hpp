@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+/* Bench helpers
+
+medianMs(runs, fn) times fn runs times and returns the median in milliseconds, setup that
+must not count goes in before/after the call. keep() feeds a result to a volatile sink so
+the loop under test can't be optimized away
+*/
+
+namespace Bench {
+
+inline volatile uint64_t sink = 0;
+
+template<typename T>
+inline void keep(T value) noexcept { sink = sink + static_cast<uint64_t>(value); }
+
+// Median of timings in ms, for loops that need untimed work between runs
+inline double median(std::vector<double> ms) {
+    if (ms.empty()) return 0.0;
+    std::sort(ms.begin(), ms.end());
+    return ms[ms.size() / 2];
+}
+
+inline double msSince(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+template<typename Fn>
+double medianMs(uint32_t runs, Fn&& fn) {
+    std::vector<double> ms;
+    ms.reserve(runs);
+
+    for (uint32_t r = 0; r < runs; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        ms.push_back(msSince(t0));
+    }
+    return median(std::move(ms));
+}
+
+inline void row(const char* label, double ms) { std::printf("  %-40s %10.3f ms\n", label, ms); }
+inline void rowNs(const char* label, double ns) { std::printf("  %-40s %10.2f ns\n", label, ns); }
+
+} // namespace Bench
@@ -0,0 +1,141 @@
+#include "bench.hpp"
+
+#include "ascFS.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+/* FS naming: hashed child index against the sibling scan it replaced
+
+Many unique files into one folder, a storm of files sharing one name, then path() and fromPath()
+on every file of a nested tree. ScanFolder rebuilds the old collision check (every sibling
+compared, once per " (n)" candidate) on the same Pool, it is quadratic (cubic for the storm)
+so it runs on a capped count and is reported next to the FS at that same count
+
+    fsBench [files] [sameName] [runs]
+*/
+
+namespace {
+
+struct ScanFolder {
+    Asc::Pool<std::string> names;
+    std::vector<Asc::Handle> children;
+
+    bool has(const std::string& name) const {
+        for (Asc::Handle h : children) {
+            const std::string* n = names.get(h);
+            if (n && *n == name) return true;
+        }
+        return false;
+    }
+
+    void create(std::string name) {
+        if (has(name)) {
+            std::string base = name;
+            size_t dot = base.find_last_of('.');
+            if (dot != std::string::npos) base = base.substr(0, dot);
+
+            int index = 1;
+            std::string candidate;
+            do {
+                candidate = base + " (" + std::to_string(++index) + ")";
+                if (dot != std::string::npos) candidate += name.substr(dot);
+            } while (has(candidate));
+            name = std::move(candidate);
+        }
+        children.push_back(names.emplace(std::move(name)));
+    }
+};
+
+std::vector<std::string> uniqueNames(uint32_t count) {
+    std::vector<std::string> out(count);
+    for (uint32_t i = 0; i < count; ++i) out[i] = "Mesh_" + std::to_string(i) + ".mesh";
+    return out;
+}
+
+// Untimed fresh FS per run, only the creates count
+double fsCreate(const std::vector<std::string>& names, uint32_t runs) {
+    std::vector<double> ms;
+    for (uint32_t r = 0; r < runs; ++r) {
+        auto fs = std::make_unique<Asc::FS>();
+        Asc::Handle folder = fs->createFolder("Import");
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (const std::string& name : names) (void)fs->createFile(name, 0, folder);
+        ms.push_back(Bench::msSince(t0));
+    }
+    return Bench::median(std::move(ms));
+}
+
+double scanCreate(const std::vector<std::string>& names, uint32_t runs) {
+    std::vector<double> ms;
+    for (uint32_t r = 0; r < runs; ++r) {
+        ScanFolder folder;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (const std::string& name : names) folder.create(name);
+        ms.push_back(Bench::msSince(t0));
+    }
+    return Bench::median(std::move(ms));
+}
+
+void creates(const char* what, const std::vector<std::string>& names, uint32_t scanCap, uint32_t runs) {
+    char label[64];
+    std::printf("%s, median of %u\n", what, runs);
+
+    std::snprintf(label, sizeof(label), "FS::createFile x%zu", names.size());
+    Bench::row(label, fsCreate(names, runs));
+
+    std::vector<std::string> capped(names.begin(), names.begin() + std::min<size_t>(scanCap, names.size()));
+    uint32_t scanRuns = std::max(1u, runs / 10);
+
+    std::snprintf(label, sizeof(label), "FS::createFile x%zu", capped.size());
+    Bench::row(label, fsCreate(capped, scanRuns));
+    std::snprintf(label, sizeof(label), "sibling scan x%zu (before)", capped.size());
+    Bench::row(label, scanCreate(capped, scanRuns));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t files = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 50000;
+    uint32_t same  = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 5000;
+    uint32_t runs  = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 10;
+    if (files == 0 || same == 0) return 0;
+
+    creates("Unique files into one folder", uniqueNames(files), 5000, runs);
+    creates("Files all named Material.mat", std::vector<std::string>(same, "Material.mat"), 500, runs);
+
+    // 10 folders x 10 subfolders, files spread over the leaves
+    Asc::FS fs;
+    std::vector<Asc::Handle> leaves;
+    for (int a = 0; a < 10; ++a) {
+        Asc::Handle top = fs.createFolder("Pack_" + std::to_string(a));
+        for (int b = 0; b < 10; ++b) leaves.push_back(fs.createFolder("Sub_" + std::to_string(b), top));
+    }
+
+    std::vector<Asc::Handle> fileHs(same);
+    for (uint32_t i = 0; i < same; ++i) {
+        fileHs[i] = fs.createFile("Tex_" + std::to_string(i) + ".png", 0, leaves[i % leaves.size()]);
+    }
+
+    std::vector<std::string> paths(same);
+    for (uint32_t i = 0; i < same; ++i) paths[i] = fs.path(fileHs[i]);
+
+    std::printf("Paths of %u files, 3 levels deep, median of %u\n", same, runs);
+
+    Bench::row("path()", Bench::medianMs(runs, [&] {
+        size_t acc = 0;
+        for (Asc::Handle h : fileHs) acc += std::strlen(fs.path(h));
+        Bench::keep(acc);
+    }));
+
+    Bench::row("fromPath()", Bench::medianMs(runs, [&] {
+        uint64_t acc = 0;
+        for (const std::string& p : paths) acc += fs.fromPath(p).index;
+        Bench::keep(acc);
+    }));
+    return 0;
+}
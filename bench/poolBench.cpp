@@ -0,0 +1,80 @@
+#include "bench.hpp"
+
+#include "ascPool.hpp"
+#include "tinyRT/rtTransform.hpp"
+
+#include <cstdlib>
+#include <deque>
+
+/* Pool iteration: contiguous dense array against the std::deque it replaced
+
+forEach over N elements, plus a raw span() walk. The deque rows rebuild the old layout (deque
+of T + deque of ids, same loop) so the two can be compared on one machine. Skeleton3D is
+stood in for by a POD of its old size, its pose arrays are heap side and never touched here
+
+    poolBench [count] [runs]
+*/
+
+namespace {
+
+struct SkeletonSized { // Skeleton3D-sized, 88 bytes
+    uint64_t words[11];
+};
+
+template<typename T, typename Touch>
+void compare(const char* name, uint32_t count, uint32_t runs, Touch touch) {
+    std::printf("%s (%zu B), %u elements, median of %u\n", name, sizeof(T), count, runs);
+
+    std::deque<T> oldData(count);
+    std::deque<uint32_t> oldIDs;
+    for (uint32_t i = 0; i < count; ++i) oldIDs.push_back(i);
+
+    Asc::Pool<T> pool;
+    Asc::Pool<T, 64> alignedPool;
+    pool.reserve(count);
+    alignedPool.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        (void)pool.emplace();
+        (void)alignedPool.emplace();
+    }
+
+    Bench::row("deque forEach (before)", Bench::medianMs(runs, [&] {
+        uint64_t acc = 0;
+        for (uint32_t i = 0; i < count; ++i) acc += touch(oldData[i]) + oldIDs[i];
+        Bench::keep(acc);
+    }));
+
+    Bench::row("Pool::forEach", Bench::medianMs(runs, [&] {
+        uint64_t acc = 0;
+        pool.forEach([&](const T& t, uint32_t id) { acc += touch(t) + id; });
+        Bench::keep(acc);
+    }));
+
+    Bench::row("Pool<T, 64>::forEach", Bench::medianMs(runs, [&] {
+        uint64_t acc = 0;
+        alignedPool.forEach([&](const T& t, uint32_t id) { acc += touch(t) + id; });
+        Bench::keep(acc);
+    }));
+
+    Bench::row("Pool::span()", Bench::medianMs(runs, [&] {
+        uint64_t acc = 0;
+        for (const T& t : pool.span()) acc += touch(t);
+        Bench::keep(acc);
+    }));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t count = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 1000000;
+    uint32_t runs  = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 20;
+
+    compare<tinyRT::Transform3D>("Transform3D", count, runs, [](const tinyRT::Transform3D& t) {
+        return static_cast<uint64_t>(t.world[3][0] + t.world[0][0]);
+    });
+
+    compare<SkeletonSized>("Skeleton3D-sized", count, runs, [](const SkeletonSized& s) {
+        return s.words[0] + s.words[10];
+    });
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include "bench.hpp"
+
+#include "ascReg.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+
+/* Registry lookup: type-ID table against the unordered_map it replaced
+
+Handles are spread over 4 pools and shuffled. get<T>(h) walks each type's handles, get(Handle)
+walks the mixed list. HashedReg rebuilds the old pool lookup (unordered_map of IPool, same
+virtual get) on top of the same Asc::Pool, so only the dispatch differs. Run once small
+(cache resident) and once large (bound by misses)
+
+    regBench [small] [large] [runs]
+*/
+
+namespace {
+
+template<uint32_t Bytes>
+struct Comp { uint32_t words[Bytes / 4]; };
+
+using A = Comp<16>;
+using B = Comp<32>;
+using C = Comp<64>;
+using D = Comp<128>;
+
+class HashedReg {
+    struct IPool {
+        virtual ~IPool() = default;
+        virtual void* get(Asc::Handle h) noexcept = 0;
+    };
+
+    template<typename T>
+    struct PoolWrapper : IPool {
+        Asc::Pool<T> pool;
+        void* get(Asc::Handle h) noexcept override { return pool.get(h); }
+    };
+
+    std::unordered_map<Asc::Type::ID, std::unique_ptr<IPool>> pools_;
+
+    template<typename T>
+    PoolWrapper<T>* getPool() noexcept {
+        auto it = pools_.find(Asc::Type::TypeID<T>());
+        return it != pools_.end() ? static_cast<PoolWrapper<T>*>(it->second.get()) : nullptr;
+    }
+
+public:
+    template<typename T>
+    Asc::Handle emplace() {
+        auto [it, inserted] = pools_.try_emplace(Asc::Type::TypeID<T>());
+        if (inserted) it->second = std::make_unique<PoolWrapper<T>>();
+        return static_cast<PoolWrapper<T>*>(it->second.get())->pool.emplace();
+    }
+
+    template<typename T>
+    T* get(Asc::Handle h) noexcept {
+        auto* pool = getPool<T>();
+        return pool ? pool->pool.get(h) : nullptr;
+    }
+
+    void* get(Asc::Handle h) noexcept {
+        if (!h) return nullptr;
+        auto it = pools_.find(h.typeID);
+        return it != pools_.end() ? it->second->get(h) : nullptr;
+    }
+};
+
+struct Handles {
+    std::vector<Asc::Handle> perType[4];
+    std::vector<Asc::Handle> mixed;
+};
+
+template<typename RegT>
+Handles fill(RegT& reg, uint32_t count, std::mt19937& rng) {
+    Handles hs;
+    for (uint32_t i = 0; i < count; ++i) {
+        Asc::Handle h;
+        switch (i % 4) {
+            case 0: h = reg.template emplace<A>(); break;
+            case 1: h = reg.template emplace<B>(); break;
+            case 2: h = reg.template emplace<C>(); break;
+            default: h = reg.template emplace<D>(); break;
+        }
+        hs.perType[i % 4].push_back(h);
+        hs.mixed.push_back(h);
+    }
+
+    for (auto& v : hs.perType) std::shuffle(v.begin(), v.end(), rng);
+    std::shuffle(hs.mixed.begin(), hs.mixed.end(), rng);
+    return hs;
+}
+
+template<typename RegT>
+uint64_t typedPass(RegT& reg, const Handles& hs) {
+    uint64_t acc = 0;
+    for (Asc::Handle h : hs.perType[0]) acc += reg.template get<A>(h)->words[0];
+    for (Asc::Handle h : hs.perType[1]) acc += reg.template get<B>(h)->words[0];
+    for (Asc::Handle h : hs.perType[2]) acc += reg.template get<C>(h)->words[0];
+    for (Asc::Handle h : hs.perType[3]) acc += reg.template get<D>(h)->words[0];
+    return acc;
+}
+
+template<typename RegT>
+uint64_t rawPass(RegT& reg, const Handles& hs) {
+    uint64_t acc = 0;
+    for (Asc::Handle h : hs.mixed) acc += *static_cast<const uint32_t*>(reg.get(h));
+    return acc;
+}
+
+void compare(uint32_t count, uint32_t runs) {
+    // Enough passes that a run is ~1M lookups whatever the count
+    uint32_t passes = std::max(1u, 1000000u / count);
+    double perLookup = 1e6 / (double(count) * passes); // ms per run -> ns per lookup
+
+    std::mt19937 rng(count);
+    Asc::Reg reg;
+    HashedReg hashed;
+    Handles hs = fill(reg, count, rng);
+    Handles hh = fill(hashed, count, rng);
+
+    std::printf("%u handles over 4 pools, %u passes, median of %u\n", count, passes, runs);
+
+    auto time = [&](auto pass) {
+        return perLookup * Bench::medianMs(runs, [&] {
+            uint64_t acc = 0;
+            for (uint32_t p = 0; p < passes; ++p) acc += pass();
+            Bench::keep(acc);
+        });
+    };
+
+    Bench::rowNs("get<T>(h), unordered_map (before)", time([&] { return typedPass(hashed, hh); }));
+    Bench::rowNs("get<T>(h), ID table",               time([&] { return typedPass(reg, hs); }));
+    Bench::rowNs("get(Handle), unordered_map (before)", time([&] { return rawPass(hashed, hh); }));
+    Bench::rowNs("get(Handle), ID table",               time([&] { return rawPass(reg, hs); }));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t small = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 1000;
+    uint32_t large = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 100000;
+    uint32_t runs  = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 20;
+
+    if (small) compare(small, runs);
+    if (large) compare(large, runs);
+    return 0;
+}
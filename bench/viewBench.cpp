@@ -0,0 +1,98 @@
+#include "bench.hpp"
+
+#include "ascReg.hpp"
+#include "tinyRT/rtTransform.hpp"
+
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+/* Multi-component visit: node walk + has<T>() against Reg::view
+
+N nodes in a 4-ary tree, all with Transform3D, 1 in 4 with a mesh. The walk rebuilds the old
+scene node (children vector + std::map comps) and recurses from the root, the view joins the
+two owned pools directly. MeshRender3D pulls in the mesh headers, a POD of its size stands in
+
+    viewBench [nodes] [runs]
+*/
+
+namespace {
+
+struct OldNode {
+    Asc::Handle parent;
+    std::vector<Asc::Handle> children;
+    std::map<Asc::Type::ID, Asc::Handle> comps;
+
+    template<typename T>
+    bool has() const noexcept { return comps.find(Asc::Type::TypeID<T>()) != comps.end(); }
+
+    template<typename T>
+    Asc::Handle get() const noexcept {
+        auto it = comps.find(Asc::Type::TypeID<T>());
+        return it != comps.end() ? it->second : Asc::Handle();
+    }
+};
+
+struct MeshSized { // MeshRender3D-sized stand-in
+    Asc::Handle mesh;
+    Asc::Handle skeleNode;
+    uint64_t words[6];
+};
+
+using tinyRT::Transform3D;
+
+template<typename F>
+void walk(Asc::Reg& reg, Asc::Handle h, F& f) {
+    const OldNode* node = reg.get<OldNode>(h);
+    if (!node) return;
+
+    if (node->has<Transform3D>() && node->has<MeshSized>()) {
+        f(*reg.get<Transform3D>(node->get<Transform3D>()), *reg.get<MeshSized>(node->get<MeshSized>()));
+    }
+    for (Asc::Handle c : node->children) walk(reg, c, f);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t count = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 100000;
+    uint32_t runs  = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 20;
+    if (count == 0) return 0;
+
+    Asc::Reg reg;
+    reg.reserve<OldNode>(count);
+    reg.reserve<Transform3D>(count);
+    reg.reserve<MeshSized>(count / 4 + 1);
+
+    std::vector<Asc::Handle> nodes(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        nodes[i] = reg.emplace<OldNode>();
+        if (i > 0) {
+            Asc::Handle parent = nodes[(i - 1) / 4];
+            reg.get<OldNode>(nodes[i])->parent = parent;
+            reg.get<OldNode>(parent)->children.push_back(nodes[i]);
+        }
+
+        OldNode* node = reg.get<OldNode>(nodes[i]);
+        node->comps[Asc::Type::TypeID<Transform3D>()] = reg.emplaceFor<Transform3D>(nodes[i]);
+        if (i % 4 == 0) node->comps[Asc::Type::TypeID<MeshSized>()] = reg.emplaceFor<MeshSized>(nodes[i]);
+    }
+
+    std::printf("%u nodes, %u with a mesh, median of %u\n", count, reg.view<MeshSized>().count(), runs);
+
+    Bench::row("node walk + has<T>() (before)", Bench::medianMs(runs, [&] {
+        uint64_t acc = 0;
+        auto f = [&](const Transform3D& t, const MeshSized& m) { acc += static_cast<uint64_t>(t.world[3][0]) + m.words[0] + 1; };
+        walk(reg, nodes[0], f);
+        Bench::keep(acc);
+    }));
+
+    Bench::row("view<Transform3D, Mesh>", Bench::medianMs(runs, [&] {
+        uint64_t acc = 0;
+        reg.view<Transform3D, MeshSized>().forEach([&](Asc::Handle, const Transform3D& t, const MeshSized& m) {
+            acc += static_cast<uint64_t>(t.world[3][0]) + m.words[0] + 1;
+        });
+        Bench::keep(acc);
+    }));
+    return 0;
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "ascType.hpp"
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+
+namespace Asc {
+
+/* Deferred structural command queue
+
+Pools may reallocate on emplace/erase, so nothing is allowed to change structure
+while someone else is reading. Record the change here instead, and flush() it at a sync point:
+
+    Handle p = q.pending();                            // any thread
+    q.push([p](Reg& r, CmdQueue<Reg>& q) {             // any thread
+        q.bind(p, r.emplace<Foo>());
+    });
+    ...
+    q.flush(reg);                                      // one thread, nobody recording
+
+Every thread records into its own buffer, so recording never fights over a lock
+(except the very first push of a thread, which registers the buffer)
+
+Flush order: buffers in the order threads first touched the queue, commands in recording order
+
+Pending handles stand in for things that don't exist yet, resolve() maps them to the
+real handle once their creating command has run. They die at the end of flush()
+*/
+
+template<typename Ctx>
+class CmdQueue {
+public:
+    using Cmd = std::function<void(Ctx&, CmdQueue&)>;
+
+    static constexpr Type::ID PENDING_TID = UINT16_MAX - 1; // Never handed out by TypeID<T>()
+
+    CmdQueue() noexcept : id_(nextID()) {}
+
+    CmdQueue(const CmdQueue&) = delete;
+    CmdQueue& operator=(const CmdQueue&) = delete;
+
+// Recording (thread-safe)
+
+    void push(Cmd&& cmd) {
+        local().cmds.push_back(std::move(cmd));
+    }
+
+    [[nodiscard]] Handle pending() noexcept {
+        return Handle(pendingCount_.fetch_add(1, std::memory_order_relaxed), 0, PENDING_TID);
+    }
+
+    [[nodiscard]] static constexpr bool isPending(Handle h) noexcept {
+        return h.valid() && h.typeID == PENDING_TID;
+    }
+
+// Applying (sync point only)
+
+    // Pending -> real, anything else passes through. Unbound pending -> invalid
+    [[nodiscard]] Handle resolve(Handle h) const noexcept {
+        if (!isPending(h)) return h;
+        return h.index < resolved_.size() ? resolved_[h.index] : Handle();
+    }
+
+    void bind(Handle pendingHandle, Handle real) {
+        if (!isPending(pendingHandle)) return;
+        if (pendingHandle.index >= resolved_.size()) resolved_.resize(pendingHandle.index + 1);
+        resolved_[pendingHandle.index] = real;
+    }
+
+    // Returns the number of commands executed
+    size_t flush(Ctx& ctx) {
+        size_t executed = 0;
+        std::vector<Cmd> batch;
+        std::vector<Buffer*> bufs;
+
+        // Commands may record more commands, keep going until everything is dry
+        bool more = true;
+        while (more) {
+            more = false;
+
+            { // Don't hold the lock while running, a command recording on a new thread would deadlock
+                std::lock_guard<std::mutex> lock(mtx_);
+                bufs.clear();
+                for (auto& buf : buffers_) bufs.push_back(buf.get());
+            }
+
+            for (Buffer* buf : bufs) {
+                if (buf->cmds.empty()) continue;
+
+                batch.clear();
+                batch.swap(buf->cmds);
+
+                for (Cmd& cmd : batch) cmd(ctx, *this);
+                executed += batch.size();
+                more = true;
+            }
+        }
+
+        resolved_.clear();
+        pendingCount_.store(0, std::memory_order_relaxed);
+        return executed;
+    }
+
+    [[nodiscard]] bool empty() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        for (const auto& buf : buffers_) {
+            if (!buf->cmds.empty()) return false;
+        }
+        return true;
+    }
+
+private:
+    struct Buffer {
+        std::thread::id tid;
+        std::vector<Cmd> cmds;
+    };
+
+    mutable std::mutex mtx_;
+    std::vector<std::unique_ptr<Buffer>> buffers_; // Stable addresses, never shrinks
+
+    std::atomic<uint32_t> pendingCount_{0};
+    std::vector<Handle> resolved_;
+
+    const uint64_t id_; // Never reused, so a stale thread cache can't match a dead queue
+
+    static uint64_t nextID() noexcept {
+        static std::atomic<uint64_t> counter{1};
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Buffer& local() {
+        // Remember the last queue this thread touched, the common case is one queue per thread
+        struct Cache { uint64_t queueID = 0; Buffer* buf = nullptr; };
+        thread_local Cache cache;
+        if (cache.queueID == id_) return *cache.buf;
+
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        std::thread::id tid = std::this_thread::get_id();
+        Buffer* buf = nullptr;
+        for (auto& b : buffers_) {
+            if (b->tid == tid) { buf = b.get(); break; }
+        }
+
+        if (!buf) {
+            buffers_.push_back(std::make_unique<Buffer>());
+            buf = buffers_.back().get();
+            buf->tid = tid;
+        }
+
+        cache = { id_, buf };
+        return *buf;
+    }
+};
+
+} // namespace Asc
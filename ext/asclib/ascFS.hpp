@@ -3,6 +3,7 @@
 #include "ascReg.hpp"
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
@@ -112,6 +113,8 @@ public:
 
         p = node(parent); // To avoid invalidation
         p->children.push_back(h);
+
+        indexChild(h);
         return h;
     }
 
@@ -142,7 +145,7 @@ public:
 
         rDataToFile_[dataHandle] = h;
 
-        updatePathCache(h);
+        indexChild(h);
 
         return h;
     }
@@ -161,10 +164,11 @@ public:
             if (oldParent) oldParent->eraseChild(nodeHandle);
         }
 
+        // Only this node's key changes, descendants are keyed by their own (unchanged) parent
+        unindexChild(nodeHandle);
         node->parent = newParentHandle;
         newParent->children.push_back(nodeHandle);
-
-        updatePathCacheRecursive(nodeHandle);
+        indexChild(nodeHandle);
 
         return true;
     }
@@ -174,9 +178,10 @@ public:
         if (!node) return;
 
         newName = resolveUniqueName(node->parent, std::move(newName), nodeHandle);
-        node->name = std::move(newName);
 
-        updatePathCacheRecursive(nodeHandle);
+        unindexChild(nodeHandle);
+        node->name = std::move(newName);
+        indexChild(nodeHandle);
     }
 
     // Return a queue of nodes in a depth-first manner
@@ -223,24 +228,48 @@ public:
             Node* parentNode = fnodes_.get(targetNode->parent);
             if (parentNode) parentNode->eraseChild(nodeHandle);
         }
+        unindexChild(nodeHandle);
+
+        auto rmOrderOf = [&](Handle h) -> uint8_t {
+            const Node* node = fnodes_.get(h);
+            const TypeInfo* tInfo = node ? typeInfo(node->data.tID()) : nullptr;
+            return tInfo ? tInfo->rmOrder : 255;
+        };
 
         // No need for child-parent updates
         // since all nodes are being erased anyway
-        for (Handle h : rmQueue) { 
-            Node* node = fnodes_.get(h); // Queue ensures validity
+        //
+        // Same rmOrder = one batch, a batch is fully gone before the next one's onDelete runs
+        std::vector<Handle> dataBatch;
+        std::vector<Handle> nodeBatch;
 
-            Handle dataHandle = node->data;
+        for (size_t i = 0; i < rmQueue.size();) {
+            uint8_t order = rmOrderOf(rmQueue[i]);
 
-            TypeInfo* tInfo = typeInfo(dataHandle.tID());
-            if (tInfo && tInfo->onDelete) {
-                if (!tInfo->onDelete(h, *this, userData)) {
-                    continue; // Skip deletion
+            dataBatch.clear();
+            nodeBatch.clear();
+
+            for (; i < rmQueue.size() && rmOrderOf(rmQueue[i]) == order; ++i) {
+                Handle h = rmQueue[i];
+                const Node* node = fnodes_.get(h);
+                if (!node) continue; // A previous onDelete got to it first
+
+                Handle dataHandle = node->data;
+
+                TypeInfo* tInfo = typeInfo(dataHandle.tID());
+                if (tInfo && tInfo->onDelete) {
+                    if (!tInfo->onDelete(h, *this, userData)) {
+                        continue; // Skip deletion
+                    }
                 }
+
+                if (dataHandle) dataBatch.push_back(dataHandle);
+                nodeBatch.push_back(h);
+                unindexChild(h);
             }
-            
-            r().erase(dataHandle);
 
-            fnodes_.erase(h);
+            r().erase(dataBatch);
+            fnodes_.erase(nodeBatch);
         }
     }
 
@@ -258,13 +287,16 @@ public:
         // Rebranch all children to rescue parent
         for (Handle childHandle : node->children) {
             if (Node* childNode = fnodes_.get(childHandle)) {
+                unindexChild(childHandle);
                 childNode->parent = rescueHandle;
                 parentNode->children.push_back(childHandle);
+                indexChild(childHandle);
             }
         }
 
         // erase the node
         parentNode->eraseChild(nodeHandle);
+        unindexChild(nodeHandle);
 
         TypeInfo* tInfo = typeInfo(node->data.tID());
         if (tInfo && tInfo->onDelete) {
@@ -273,6 +305,9 @@ public:
             }
         }
 
+        node = fnodes_.get(nodeHandle); // onDelete may have touched the pool
+        if (!node) return;
+
         r().erase(node->data);
         fnodes_.erase(nodeHandle);
     }
@@ -331,24 +366,53 @@ public:
         return typeInfo(typeID(fileHandle));
     }
 
+    // Built from the parent chain on demand, nothing is cached per node
     [[nodiscard]] const char* path(Handle handle, const char* rootAlias = nullptr) const noexcept {
-        auto it = pathCache_.find(handle);
-        if (it == pathCache_.end()) return nullptr;
+        if (!fnodes_.get(handle)) return nullptr;
+
+        thread_local std::vector<const Node*> chain;
+        chain.clear();
+        for (const Node* n = fnodes_.get(handle); n; n = fnodes_.get(n->parent)) chain.push_back(n);
 
         thread_local std::string result;
         result.clear();
 
-        for (size_t i = 0; i < it->second.size(); ++i) {
-            const Node* n = fnodes_.get(it->second[i]);
-            if (!n) continue;
-            if (i == 0 && rootAlias) result += rootAlias;
-            else result += n->name;
-            if (i + 1 < it->second.size()) result += '/';
+        for (size_t i = chain.size(); i-- > 0;) {
+            if (i + 1 == chain.size() && rootAlias) result += rootAlias;
+            else result += chain[i]->name;
+            if (i > 0) result += '/';
         }
 
         return result.c_str();
     }
 
+    // Direct child by name, O(1)
+    [[nodiscard]] Handle child(Handle parent, std::string_view name) const noexcept {
+        auto range = childIndex_.equal_range(childKey(parent, name));
+        for (auto it = range.first; it != range.second; ++it) {
+            const Node* n = fnodes_.get(it->second);
+            if (n && n->parent == parent && n->name == name) return it->second;
+        }
+        return Handle();
+    }
+
+    // Inverse of path(): "root/models/cube.glb" -> handle, one hash probe per segment
+    [[nodiscard]] Handle fromPath(std::string_view fullPath, const char* rootAlias = nullptr) const noexcept {
+        size_t slash = fullPath.find('/');
+        std::string_view head = fullPath.substr(0, slash);
+
+        std::string_view rootName = rootAlias ? std::string_view(rootAlias) : std::string_view(name(rootHandle_));
+        if (head != rootName) return Handle();
+
+        Handle cur = rootHandle_;
+        while (slash != std::string_view::npos && cur) {
+            fullPath.remove_prefix(slash + 1);
+            slash = fullPath.find('/');
+            cur = child(cur, fullPath.substr(0, slash));
+        }
+        return cur;
+    }
+
 // ------------------------------- Type info -------------------------------
 
     TypeInfo* typeInfo(Type::ID typeID) noexcept {
@@ -372,6 +436,30 @@ public:
         return typeInfo(Type::TypeID<T>());
     }
 
+// ------------------------------- Stats -------------------------------
+
+    struct Stats {
+        PoolStats nodes;            // the file/folder tree itself
+        PoolStats data;             // everything in r(), see r().poolStats() for the breakdown
+        size_t    indexEntries = 0; // child name index + data->file map
+        size_t    indexBytes = 0;   // estimate, node-based containers don't expose their allocations
+    };
+
+    [[nodiscard]] Stats stats() const {
+        // Bucket array + one heap node (value + next + cached hash) per entry
+        auto mapBytes = [](const auto& m) {
+            using V = typename std::decay_t<decltype(m)>::value_type;
+            return m.bucket_count() * sizeof(void*) + m.size() * (sizeof(V) + 2 * sizeof(void*));
+        };
+
+        Stats st;
+        st.nodes = fnodes_.stats();
+        st.data  = registry_.totalStats();
+        st.indexEntries = childIndex_.size() + rDataToFile_.size() + suffixHint_.size();
+        st.indexBytes   = mapBytes(childIndex_) + mapBytes(rDataToFile_) + mapBytes(suffixHint_);
+        return st;
+    }
+
 // ------------------------------- Some accessors -------------------------------
 
     // Restricted access to fnodes
@@ -420,64 +508,92 @@ private:
 
     TINY_FORCE_INLINE Node* node(Handle nodeHandle) noexcept { return fnodes_.get(nodeHandle); }
 
-    std::unordered_map<Handle, std::vector<Handle>> pathCache_;
+    // (parent, name) hash -> child, multi since hashes can collide (and move() doesn't rename)
+    std::unordered_multimap<uint64_t, Handle> childIndex_;
+    std::unordered_map<uint64_t, int> suffixHint_; // (parent, base name) -> last " (n)" handed out, dropped once one of them leaves
     std::unordered_map<Handle, Handle> rDataToFile_;
     std::unordered_map<Type::ID, TypeInfo> typeInfo_;
 
-    std::string resolveUniqueName(Handle parent, std::string name, Handle exclude = {}) const {
+    std::string resolveUniqueName(Handle parent, std::string name, Handle exclude = {}) {
         const Node* p = fnodes_.get(parent);
         if (!p) return name;
 
-        if (!hasChildWithName(p, name, exclude)) return name;
+        if (!hasChildWithName(parent, name, exclude)) return name;
 
-        int index = 1;
         std::string base = name;
         size_t dot = base.find_last_of('.');
         if (dot != std::string::npos) base = base.substr(0, dot);
 
+        // Pick up where the last collision on this name left off, a folder full of
+        // "Material" would otherwise retry every suffix from (2) on each import
+        int& index = suffixHint_[childKey(parent, name)];
+        if (index < 1) index = 1;
+
         std::string candidate;
         do {
             candidate = base + " (" + std::to_string(++index) + ")";
             if (dot != std::string::npos) {
                 candidate += name.substr(dot);
             }
-        } while (hasChildWithName(p, candidate, exclude));
+        } while (hasChildWithName(parent, candidate, exclude));
 
         return candidate;
     }
 
-    bool hasChildWithName(const Node* parent, const std::string& name, Handle exclude) const {
-        for (Handle h : parent->children) {
-            if (h == exclude) continue;
-            const Node* child = fnodes_.get(h);
-            if (child && child->name == name) return true;
+    bool hasChildWithName(Handle parent, std::string_view name, Handle exclude) const {
+        auto range = childIndex_.equal_range(childKey(parent, name));
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == exclude) continue;
+            const Node* n = fnodes_.get(it->second);
+            if (n && n->parent == parent && n->name == name) return true;
         }
         return false;
     }
 
-    void updatePathCache(Handle h) {
-        std::vector<Handle> path;
-        Handle cur = h;
-        while (cur) {
-            path.push_back(cur);
-            const Node* n = fnodes_.get(cur);
-            if (!n) break;
-            cur = n->parent;
+    // FNV-1a over the name, seeded with the parent handle
+    static uint64_t childKey(Handle parent, std::string_view name) noexcept {
+        uint64_t h = 14695981039346656037ull ^ (parent.value * 0x9E3779B97F4A7C15ull);
+        for (char c : name) {
+            h ^= static_cast<uint8_t>(c);
+            h *= 1099511628211ull;
         }
-        std::reverse(path.begin(), path.end());
-        pathCache_[h] = std::move(path);
+        return h;
     }
 
-    void updatePathCacheRecursive(Handle h) {
-        updatePathCache(h);
-        Node* node = fnodes_.get(h);
-        if (node) {
-            for (Handle child : node->children) {
-                updatePathCacheRecursive(child);
-            }
+    void indexChild(Handle h) {
+        const Node* n = fnodes_.get(h);
+        if (!n || !n->parent) return;
+        childIndex_.emplace(childKey(n->parent, n->name), h);
+    }
+
+    void unindexChild(Handle h) {
+        const Node* n = fnodes_.get(h);
+        if (!n) return;
+
+        // A free slot below the hint now, the next collision probes from (2) again
+        if (!suffixHint_.empty()) suffixHint_.erase(childKey(n->parent, unsuffixed(n->name)));
+
+        auto range = childIndex_.equal_range(childKey(n->parent, n->name));
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == h) { childIndex_.erase(it); return; }
         }
     }
 
+    // "Name (n).ext" -> "Name.ext", what resolveUniqueName() was asked for
+    static std::string unsuffixed(const std::string& name) {
+        size_t dot = name.find_last_of('.');
+        size_t end = dot == std::string::npos ? name.size() : dot;
+        if (end < 4 || name[end - 1] != ')') return name;
+
+        size_t open = name.rfind(" (", end - 1);
+        if (open == std::string::npos || open + 2 >= end - 1) return name;
+        for (size_t i = open + 2; i < end - 1; ++i) {
+            if (name[i] < '0' || name[i] > '9') return name;
+        }
+
+        return name.substr(0, open) + name.substr(end);
+    }
+
     bool isDescendant(Handle ancestor, Handle descendant) const {
         Handle cur = fnodes_.get(descendant)->parent;
         while (cur) {
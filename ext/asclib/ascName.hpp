@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <shared_mutex>
+#include <mutex>
+#include <unordered_map>
+
+namespace Asc {
+
+/* Interned strings
+
+One process-wide table, every distinct string is stored once and gets a small ID.
+Comparing two names is comparing two uint32_t, and the ID is the same in every scene
+
+    Name::ID id = Name::intern("Debug");
+    Name::str(id); // "Debug", reference stays valid forever
+
+ID 0 is the empty string. Nothing is ever removed, names are meant to be a bounded set
+*/
+
+struct Name {
+    using ID = uint32_t;
+    static constexpr ID EMPTY = 0;
+    static constexpr ID NONE = UINT32_MAX; // Never handed out, see find()
+
+    static ID intern(std::string_view s) {
+        if (s.empty()) return EMPTY;
+        Table& t = table();
+
+        {
+            std::shared_lock<std::shared_mutex> lock(t.mtx);
+            auto it = t.ids.find(s);
+            if (it != t.ids.end()) return it->second;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(t.mtx);
+        auto it = t.ids.find(s); // Someone else may have beaten us to it
+        if (it != t.ids.end()) return it->second;
+
+        ID id = static_cast<ID>(t.strs.size());
+        t.strs.push_back(std::make_unique<std::string>(s));
+        t.ids.emplace(*t.strs.back(), id); // Key views the boxed string, it never moves
+        return id;
+    }
+
+    // Lookup without inserting, NONE if the string was never interned
+    [[nodiscard]] static ID find(std::string_view s) {
+        if (s.empty()) return EMPTY;
+        Table& t = table();
+
+        std::shared_lock<std::shared_mutex> lock(t.mtx);
+        auto it = t.ids.find(s);
+        return it != t.ids.end() ? it->second : NONE;
+    }
+
+    [[nodiscard]] static const std::string& str(ID id) {
+        Table& t = table();
+
+        std::shared_lock<std::shared_mutex> lock(t.mtx);
+        return id < t.strs.size() ? *t.strs[id] : *t.strs[EMPTY];
+    }
+
+    [[nodiscard]] static size_t count() {
+        Table& t = table();
+
+        std::shared_lock<std::shared_mutex> lock(t.mtx);
+        return t.strs.size();
+    }
+
+private:
+    struct Table {
+        std::shared_mutex mtx;
+        std::vector<std::unique_ptr<std::string>> strs; // Boxed, references survive growth
+        std::unordered_map<std::string_view, ID> ids;
+
+        Table() { strs.push_back(std::make_unique<std::string>()); }
+    };
+
+    static Table& table() {
+        static Table t;
+        return t;
+    }
+};
+
+} // namespace Asc
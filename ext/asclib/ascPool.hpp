@@ -3,12 +3,16 @@
 #include "ascType.hpp"
 
 #include <new>
-#include <deque>
 #include <vector>
 #include <utility>
 #include <cstring>
+#include <algorithm>
 #include <type_traits>
 
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
     #define TINY_LIKELY(x)   __builtin_expect(!!(x), 1)
     #define TINY_UNLIKELY(x) __builtin_expect(!!(x), 0)
@@ -23,8 +27,136 @@
 
 namespace Asc {
 
-template<typename T>
+// Debug switch: every parallelForEach/parallelFor runs its chunks on the calling thread, in order
+inline bool parallelDeterministic = false;
+
+namespace detail {
+    // Chunk size for parallel loops, ~4 chunks per thread unless told otherwise.
+    // Small elements get whole cache lines per chunk so neighbours never write the same line
+    inline uint32_t chunkGrain(uint32_t count, uint32_t grainSize, size_t elemSize) noexcept {
+        uint32_t grain = grainSize;
+        if (grain == 0) {
+#ifdef _OPENMP
+            uint32_t threads = static_cast<uint32_t>(omp_get_max_threads());
+#else
+            uint32_t threads = 1;
+#endif
+            grain = count / (threads * 4);
+        }
+        if (grain == 0) grain = 1;
+
+        if (elemSize < 64) {
+            size_t a = elemSize, b = 64;
+            while (b) { size_t t = a % b; a = b; b = t; } // gcd
+            uint32_t perLine = static_cast<uint32_t>(64 / a);
+            grain = (grain + perLine - 1) / perLine * perLine;
+        }
+        return grain;
+    }
+
+    // Run body(begin, end) over [0, count) in chunks, OpenMP 2.0 friendly (MSVC)
+    template<typename Body>
+    void parallelChunks(uint32_t count, uint32_t grain, Body&& body) {
+        const int chunks = static_cast<int>((count + grain - 1) / grain);
+
+        auto run = [&](int c) {
+            uint32_t begin = static_cast<uint32_t>(c) * grain;
+            uint32_t end = count - begin > grain ? begin + grain : count;
+            body(begin, end);
+        };
+
+#ifdef _OPENMP
+        if (!parallelDeterministic && chunks > 1) {
+            #pragma omp parallel for schedule(dynamic, 1)
+            for (int c = 0; c < chunks; ++c) run(c);
+            return;
+        }
+#endif
+        for (int c = 0; c < chunks; ++c) run(c);
+    }
+}
+
+// Same chunked loop for work that isn't a pool walk, body(begin, end) over [0, count).
+// With a fixed grainSize, begin / grainSize is a stable chunk index (handy for per-chunk output)
+template<typename Body>
+void parallelFor(uint32_t count, uint32_t grainSize, Body&& body) {
+    if (count == 0) return;
+    detail::parallelChunks(count, detail::chunkGrain(count, grainSize, 64), std::forward<Body>(body));
+}
+
+// Allocator for the dense array, lets a pool start its data on a cache line (or SIMD lane) boundary
+template<typename T, size_t Align = alignof(T)>
+struct AlignedAlloc {
+    using value_type = T;
+
+    static constexpr size_t ALIGN = Align < alignof(T) ? alignof(T) : Align;
+
+    template<typename U> struct rebind { using other = AlignedAlloc<U, Align>; };
+
+    AlignedAlloc() noexcept = default;
+    template<typename U> AlignedAlloc(const AlignedAlloc<U, Align>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t n) {
+        if constexpr (ALIGN > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(ALIGN)));
+        } else {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+    }
+
+    void deallocate(T* p, size_t) noexcept {
+        if constexpr (ALIGN > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(p, std::align_val_t(ALIGN));
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    template<typename U> bool operator==(const AlignedAlloc<U, Align>&) const noexcept { return true; }
+    template<typename U> bool operator!=(const AlignedAlloc<U, Align>&) const noexcept { return false; }
+};
+
+// Memory/occupancy snapshot of one pool (heap owned BY the elements, eg. strings, is not counted)
+struct PoolStats {
+    uint32_t count     = 0; // live elements
+    uint32_t capacity  = 0; // dense slots allocated
+    uint32_t slots     = 0; // handle indices ever handed out (sparse/version length)
+    uint32_t freeSlots = 0; // recycled indices waiting in the free list
+    uint32_t elemSize  = 0; // sizeof(T)
+
+    size_t denseBytes   = 0; // data + ids (+ owners/change ticks), at capacity
+    size_t sparseBytes  = 0; // sparse + versions + owner sparse, at capacity
+    size_t freeBytes    = 0; // free list, at capacity
+    size_t slackBytes   = 0; // part of the above allocated but unused
+
+    [[nodiscard]] size_t totalBytes() const noexcept { return denseBytes + sparseBytes + freeBytes; }
+    [[nodiscard]] float occupancy() const noexcept { return capacity ? float(count) / float(capacity) : 1.0f; }
+
+    PoolStats& operator+=(const PoolStats& o) noexcept {
+        count += o.count; capacity += o.capacity; slots += o.slots; freeSlots += o.freeSlots;
+        denseBytes += o.denseBytes; sparseBytes += o.sparseBytes; freeBytes += o.freeBytes; slackBytes += o.slackBytes;
+        return *this;
+    }
+};
+
+/* Pool storage rules:
+
+Dense data is ONE contiguous array, data() + count() can be handed straight to SIMD/GPU copies
+
+- Handles stay valid across emplace/erase (sparse + version indirection)
+- Raw T* / span() do NOT, any emplace may reallocate, any erase swaps the last element in
+- forEach is index based, emplacing during iteration is fine (new elements are not visited)
+- emplaceFor links an element to an owner handle, getFor(owner) is then a single probe
+- emplaceN / emplaceForN / erase(Span) do the bookkeeping once per batch, use them for subtrees
+- trackChanges() stamps every write()/markChanged() with the current tick, see forEachChanged
+- parallelForEach may only touch the element it is handed (and read anything that isn't changing)
+
+Align = 64 puts the dense array on a cache line boundary
+*/
+
+template<typename T, size_t Align = alignof(T)>
 struct Pool {
+    using value_type = T;
     inline static const Type::ID TYPE_ID = Type::TypeID<T>();
 
     Pool() noexcept = default;
@@ -66,9 +198,115 @@ struct Pool {
         // map handle index -> dense position
         sparse_[index] = densePos;
 
+        // keep owner links parallel to dense once they are in use
+        if (!owners_.empty()) owners_.emplace_back();
+        if (tracking_) changedAt_.push_back(tick_); // new counts as changed
+
         return Handle(index, ver, TYPE_ID);
     }
 
+    // Emplace an element owned by another handle (eg. a scene node), one per owner
+    template<typename... Args>
+    Handle emplaceFor(Handle owner, Args&&... args) {
+        if (!owner || getFor(owner)) return Handle();
+
+        Handle h = emplace(std::forward<Args>(args)...);
+
+        uint32_t densePos = count() - 1;
+        owners_.resize(count());
+        owners_[densePos] = owner;
+
+        if (owner.index >= ownerSparse_.size()) ownerSparse_.resize(owner.index + 1, UINT32_MAX);
+        ownerSparse_[owner.index] = densePos;
+
+        return h;
+    }
+
+    // -------------------------- Bulk emplace --------------------------
+
+    // out.size() copies of T(args...), handles written to out. One grow per array instead of n
+    template<typename... Args>
+    void emplaceN(Span<Handle> out, const Args&... args) {
+        const uint32_t n = out.size();
+        if (n == 0) return;
+
+        const uint32_t base = count();
+        const uint32_t reused = n < freeList_.size() ? n : static_cast<uint32_t>(freeList_.size());
+        const uint32_t fresh = n - reused;
+
+        // Geometric, an exact reserve would reallocate on every batch (quadratic over many small ones)
+        if (base + n > denseData_.capacity()) {
+            const size_t cap = std::max<size_t>(base + n, denseData_.capacity() * 2);
+            denseData_.reserve(cap);
+            denseIDs_.reserve(cap);
+        }
+
+        // Recycled indices first (same order emplace would pop them)
+        for (uint32_t i = 0; i < reused; ++i) {
+            uint32_t index = freeList_[freeList_.size() - 1 - i];
+            out[i] = Handle(index, versions_[index], TYPE_ID);
+        }
+        freeList_.resize(freeList_.size() - reused);
+
+        // Then brand new ones, sparse/versions grow once
+        const uint32_t firstNew = static_cast<uint32_t>(versions_.size());
+        versions_.resize(firstNew + fresh, 0);
+        sparse_.resize(firstNew + fresh, UINT32_MAX);
+        for (uint32_t i = 0; i < fresh; ++i) out[reused + i] = Handle(firstNew + i, 0, TYPE_ID);
+
+        for (uint32_t i = 0; i < n; ++i) {
+            denseIDs_.push_back(out[i].index);
+            denseData_.emplace_back(args...);
+            sparse_[out[i].index] = base + i;
+        }
+
+        if (!owners_.empty()) owners_.resize(base + n);
+        if (tracking_) changedAt_.resize(base + n, tick_);
+    }
+
+    // Batch emplaceFor, out[i] belongs to owners[i] (invalid if that owner is taken or invalid)
+    template<typename... Args>
+    void emplaceForN(Span<const Handle> owners, Span<Handle> out, const Args&... args) {
+        const uint32_t n = owners.size();
+        if (n == 0 || out.size() < n) return;
+
+        uint32_t maxOwner = 0;
+        for (uint32_t i = 0; i < n; ++i) {
+            if (owners[i] && owners[i].index > maxOwner) maxOwner = owners[i].index;
+        }
+
+        if (maxOwner >= ownerSparse_.size()) ownerSparse_.resize(maxOwner + 1, UINT32_MAX);
+
+        // Filter first so the batch itself stays tight, repeated owners: first one wins
+        // Accepted owners are parked on PENDING, no side table sized by the whole owner range
+        constexpr uint32_t PENDING = UINT32_MAX - 1;
+        std::vector<uint32_t> accepted;
+        accepted.reserve(n);
+
+        for (uint32_t i = 0; i < n; ++i) {
+            out[i] = Handle();
+            Handle owner = owners[i];
+            if (!owner || ownerSparse_[owner.index] == PENDING || getFor(owner)) continue;
+
+            ownerSparse_[owner.index] = PENDING;
+            accepted.push_back(i);
+        }
+        if (accepted.empty()) return;
+
+        std::vector<Handle> made(accepted.size());
+        emplaceN(Span<Handle>(made), args...);
+
+        const uint32_t base = count() - static_cast<uint32_t>(made.size());
+        owners_.resize(count());
+
+        for (uint32_t k = 0; k < accepted.size(); ++k) {
+            Handle owner = owners[accepted[k]];
+            owners_[base + k] = owner;
+            ownerSparse_[owner.index] = base + k;
+            out[accepted[k]] = made[k];
+        }
+    }
+
     // -------------------------- Get --------------------------
     T* get(Handle h) noexcept {
         if (TINY_UNLIKELY(!h || h.typeID != TYPE_ID)) return nullptr;
@@ -83,6 +321,32 @@ struct Pool {
 
     const T* get(Handle h) const noexcept { return const_cast<Pool*>(this)->get(h); }
 
+    // Lookup by owner, single sparse probe + full handle compare (stale owners miss)
+    TINY_FORCE_INLINE T* getFor(Handle owner) noexcept {
+        uint32_t densePos = posFor(owner);
+        return densePos != UINT32_MAX ? &denseData_[densePos] : nullptr;
+    }
+
+    TINY_FORCE_INLINE const T* getFor(Handle owner) const noexcept { return const_cast<Pool*>(this)->getFor(owner); }
+
+    [[nodiscard]] TINY_FORCE_INLINE uint32_t posFor(Handle owner) const noexcept {
+        uint32_t idx = owner.index;
+        if (!owner || idx >= ownerSparse_.size()) return UINT32_MAX;
+        uint32_t densePos = ownerSparse_[idx];
+        return densePos != UINT32_MAX && owners_[densePos] == owner ? densePos : UINT32_MAX;
+    }
+
+    [[nodiscard]] TINY_FORCE_INLINE Handle ownerAt(uint32_t densePos) const noexcept {
+        return densePos < owners_.size() ? owners_[densePos] : Handle();
+    }
+
+    // Dense position of a handle, UINT32_MAX if invalid
+    [[nodiscard]] TINY_FORCE_INLINE uint32_t posOf(Handle h) const noexcept {
+        if (!h || h.typeID != TYPE_ID || h.index >= sparse_.size()) return UINT32_MAX;
+        if (versions_[h.index] != h.ver()) return UINT32_MAX;
+        return sparse_[h.index];
+    }
+
     // -------------------------- Erase --------------------------
     void erase(Handle h) noexcept {
         if (TINY_UNLIKELY(!h || h.typeID != TYPE_ID)) return;
@@ -95,16 +359,31 @@ struct Pool {
 
         uint32_t last = static_cast<uint32_t>(denseData_.size() - 1);
 
+        // unlink owner, the moved element (if any) takes over the slot below
+        if (!owners_.empty()) {
+            Handle owner = owners_[densePos];
+            if (owner && ownerSparse_[owner.index] == densePos) ownerSparse_[owner.index] = UINT32_MAX;
+
+            if (densePos != last) {
+                Handle movedOwner = owners_[last];
+                owners_[densePos] = movedOwner;
+                if (movedOwner && ownerSparse_[movedOwner.index] == last) ownerSparse_[movedOwner.index] = densePos;
+            }
+            owners_.pop_back();
+        }
+
         // swap last element into erased slot if not last
         if (densePos != last) {
             denseData_[densePos] = std::move(denseData_[last]);
             uint32_t movedID = denseIDs_[last];
             denseIDs_[densePos] = movedID;
             sparse_[movedID] = densePos;
+            if (tracking_) changedAt_[densePos] = changedAt_[last];
         }
 
         denseData_.pop_back();
         denseIDs_.pop_back();
+        if (tracking_) changedAt_.pop_back();
 
         // mark sparse slot free and bump version
         sparse_[idx] = UINT32_MAX;
@@ -112,15 +391,75 @@ struct Pool {
         freeList_.push_back(idx);
     }
 
-    // -------------------------- Clear --------------------------
-    void clear() noexcept {
-        // destroy non-trivial objects
-        if constexpr (!std::is_trivially_destructible_v<T>) {
-            for (T& obj : denseData_) obj.~T();
+    // Batch erase, dead slots get filled from the live tail in one sweep
+    // Invalid, stale and repeated handles are skipped. Returns how many were erased
+    uint32_t erase(Span<const Handle> hs) noexcept {
+        if (hs.empty()) return 0;
+
+        const uint32_t n = count();
+        std::vector<bool> dead(n, false);
+        uint32_t killed = 0;
+        uint32_t firstDead = n;
+
+        for (Handle h : hs) {
+            uint32_t pos = posOf(h);
+            if (pos == UINT32_MAX || dead[pos]) continue;
+
+            dead[pos] = true;
+            ++killed;
+            if (pos < firstDead) firstDead = pos;
+
+            // Retire the handle now, the slot itself is dealt with below
+            uint32_t idx = h.index;
+            sparse_[idx] = UINT32_MAX;
+            ++versions_[idx];
+            freeList_.push_back(idx);
+
+            if (!owners_.empty() && owners_[pos]) {
+                uint32_t& link = ownerSparse_[owners_[pos].index];
+                if (link == pos) link = UINT32_MAX;
+            }
+        }
+        if (killed == 0) return 0;
+
+        const uint32_t newCount = n - killed;
+        const bool hasOwners = !owners_.empty();
+
+        // Holes below newCount take survivors from above it, same swap-remove spirit as erase()
+        // Nothing below the first dead slot moves, a batch near the tail stays O(batch)
+        uint32_t tail = n;
+        for (uint32_t hole = firstDead; hole < newCount; ++hole) {
+            if (!dead[hole]) continue;
+
+            do { --tail; } while (dead[tail]);
+
+            denseData_[hole] = std::move(denseData_[tail]);
+            denseIDs_[hole] = denseIDs_[tail];
+            sparse_[denseIDs_[hole]] = hole;
+
+            if (hasOwners) {
+                owners_[hole] = owners_[tail];
+                if (owners_[hole] && ownerSparse_[owners_[hole].index] == tail) ownerSparse_[owners_[hole].index] = hole;
+            }
+
+            if (tracking_) changedAt_[hole] = changedAt_[tail];
         }
 
+        denseData_.erase(denseData_.begin() + newCount, denseData_.end());
+        denseIDs_.resize(newCount);
+        if (hasOwners) owners_.resize(newCount);
+        if (tracking_) changedAt_.resize(newCount);
+
+        return killed;
+    }
+
+    // -------------------------- Clear --------------------------
+    void clear() noexcept {
         denseData_.clear();
         denseIDs_.clear();
+        owners_.clear();
+        ownerSparse_.clear();
+        changedAt_.clear();
 
         // mark all sparse slots free, increment version
         for (uint32_t i = 0; i < sparse_.size(); ++i) {
@@ -134,20 +473,222 @@ struct Pool {
         for (uint32_t i = 0; i < sparse_.size(); ++i) freeList_.push_back(i);
     }
 
+    // -------------------------- Reorder --------------------------
+
+    // order[newPos] = oldPos, must be a permutation of [0, count)
+    // Handles (and owner links) stay valid, raw pointers do not
+    bool permute(Span<const uint32_t> order) {
+        const uint32_t n = count();
+        if (order.size() != n) return false;
+
+        std::vector<bool> visited(n, false);
+        for (uint32_t oldPos : order) {
+            if (oldPos >= n || visited[oldPos]) return false;
+            visited[oldPos] = true;
+        }
+
+        const bool hasOwners = !owners_.empty();
+
+        // Walk each cycle once, one temporary per cycle
+        std::fill(visited.begin(), visited.end(), false);
+        for (uint32_t start = 0; start < n; ++start) {
+            if (visited[start]) continue;
+            if (order[start] == start) { visited[start] = true; continue; }
+
+            T        tmpData  = std::move(denseData_[start]);
+            uint32_t tmpID    = denseIDs_[start];
+            Handle   tmpOwner = hasOwners ? owners_[start] : Handle();
+            uint32_t tmpTick  = tracking_ ? changedAt_[start] : 0;
+
+            uint32_t cur = start;
+            while (true) {
+                visited[cur] = true;
+                uint32_t src = order[cur];
+                if (src == start) break;
+
+                denseData_[cur] = std::move(denseData_[src]);
+                denseIDs_[cur] = denseIDs_[src];
+                if (hasOwners) owners_[cur] = owners_[src];
+                if (tracking_) changedAt_[cur] = changedAt_[src];
+
+                cur = src;
+            }
+
+            denseData_[cur] = std::move(tmpData);
+            denseIDs_[cur] = tmpID;
+            if (hasOwners) owners_[cur] = tmpOwner;
+            if (tracking_) changedAt_[cur] = tmpTick;
+        }
+
+        // Rewire sparse sides, owner links only follow the element they still point at
+        std::vector<uint32_t> linked;
+        if (hasOwners) {
+            for (uint32_t pos = 0; pos < n; ++pos)
+                if (owners_[pos] && ownerSparse_[owners_[pos].index] == order[pos]) linked.push_back(pos);
+        }
+        for (uint32_t pos = 0; pos < n; ++pos) sparse_[denseIDs_[pos]] = pos;
+        for (uint32_t pos : linked) ownerSparse_[owners_[pos].index] = pos;
+
+        return true;
+    }
+
+    template<typename Cmp>
+    void sort(Cmp&& cmp) {
+        std::vector<uint32_t> order(count());
+        for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return cmp(denseData_[a], denseData_[b]);
+        });
+
+        permute(order);
+    }
+
+    // -------------------------- Change tracking --------------------------
+
+    // Off by default. Turning it on marks everything as changed in the current tick
+    void trackChanges(bool on = true) {
+        tracking_ = on;
+        if (on) changedAt_.assign(count(), tick_);
+        else    std::vector<uint32_t>().swap(changedAt_);
+    }
+
+    [[nodiscard]] bool tracksChanges() const noexcept { return tracking_; }
+    [[nodiscard]] uint32_t tick() const noexcept { return tick_; }
+
+    // Frame-level reset, O(1): nothing is "changed this tick" until written again
+    uint32_t nextTick() noexcept { return ++tick_; }
+
+    TINY_FORCE_INLINE void markChangedAt(uint32_t densePos) noexcept {
+        if (tracking_) changedAt_[densePos] = tick_;
+    }
+
+    void markChanged(Handle h) noexcept {
+        uint32_t densePos = posOf(h);
+        if (densePos != UINT32_MAX) markChangedAt(densePos);
+    }
+
+    // get() for writing, stamps the element
+    T* write(Handle h) noexcept {
+        uint32_t densePos = posOf(h);
+        if (densePos == UINT32_MAX) return nullptr;
+        markChangedAt(densePos);
+        return &denseData_[densePos];
+    }
+
+    T* writeFor(Handle owner) noexcept {
+        uint32_t densePos = posFor(owner);
+        if (densePos == UINT32_MAX) return nullptr;
+        markChangedAt(densePos);
+        return &denseData_[densePos];
+    }
+
+    // Untracked pools report everything as changed, so consumers degrade to a full pass
+    [[nodiscard]] bool changedSince(Handle h, uint32_t since) const noexcept {
+        uint32_t densePos = posOf(h);
+        if (densePos == UINT32_MAX) return false;
+        return !tracking_ || changedAt_[densePos] > since;
+    }
+
+    // Elements written after tick `since`, systems keep their own last-seen tick()
+    template<typename F>
+    void forEachChangedSince(uint32_t since, F&& f) {
+        const uint32_t n = count();
+        for (uint32_t i = 0; i < n && i < denseData_.size(); ++i) {
+            if (tracking_ && changedAt_[i] <= since) continue;
+            f(denseData_[i], denseIDs_[i]);
+        }
+    }
+
+    // Elements written during the current tick
+    template<typename F>
+    void forEachChanged(F&& f) {
+        forEachChangedSince(tick_ - 1, std::forward<F>(f));
+    }
+
     // -------------------------- Iterate --------------------------
     template<typename F>
     void forEach(F&& f) {
-        for (uint32_t i = 0; i < denseData_.size(); ++i) {
+        // Snapshot the count, anything emplaced by f lands past it
+        const uint32_t n = count();
+        for (uint32_t i = 0; i < n && i < denseData_.size(); ++i) {
             f(denseData_[i], denseIDs_[i]);
         }
     }
 
+    template<typename F>
+    void forEach(F&& f) const {
+        const uint32_t n = count();
+        for (uint32_t i = 0; i < n; ++i) {
+            f(denseData_[i], denseIDs_[i]);
+        }
+    }
+
+    // forEach split across cores (grainSize 0 = auto). No emplace/erase from f, anywhere
+    template<typename F>
+    void parallelForEach(F&& f, uint32_t grainSize = 0) {
+        const uint32_t n = count();
+        if (n == 0) return;
+
+        T* data = denseData_.data();
+        const uint32_t* ids = denseIDs_.data();
+
+        detail::parallelChunks(n, detail::chunkGrain(n, grainSize, sizeof(T)), [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) f(data[i], ids[i]);
+        });
+    }
+
+    // -------------------------- Stats --------------------------
+    [[nodiscard]] PoolStats stats() const noexcept {
+        auto bytes = [](const auto& v) { return v.capacity() * sizeof(v[0]); };
+        auto slack = [](const auto& v) { return (v.capacity() - v.size()) * sizeof(v[0]); };
+
+        PoolStats st;
+        st.count     = count();
+        st.capacity  = capacity();
+        st.slots     = static_cast<uint32_t>(versions_.size());
+        st.freeSlots = static_cast<uint32_t>(freeList_.size());
+        st.elemSize  = static_cast<uint32_t>(sizeof(T));
+
+        st.denseBytes  = bytes(denseData_) + bytes(denseIDs_) + bytes(owners_) + bytes(changedAt_);
+        st.sparseBytes = bytes(sparse_) + bytes(versions_) + bytes(ownerSparse_);
+        st.freeBytes   = bytes(freeList_);
+        st.slackBytes  = slack(denseData_) + slack(denseIDs_) + slack(owners_) + slack(changedAt_) +
+                         slack(sparse_) + slack(versions_) + slack(ownerSparse_) + slack(freeList_);
+        return st;
+    }
+
+    // -------------------------- Raw access --------------------------
+    [[nodiscard]] TINY_FORCE_INLINE T* data() noexcept { return denseData_.data(); }
+    [[nodiscard]] TINY_FORCE_INLINE const T* data() const noexcept { return denseData_.data(); }
+
+    [[nodiscard]] TINY_FORCE_INLINE Span<T> span() noexcept { return Span<T>(denseData_.data(), count()); }
+    [[nodiscard]] TINY_FORCE_INLINE Span<const T> span() const noexcept { return Span<const T>(denseData_.data(), count()); }
+
+    // Dense position -> handle index (parallel to span())
+    [[nodiscard]] TINY_FORCE_INLINE Span<const uint32_t> ids() const noexcept { return Span<const uint32_t>(denseIDs_.data(), count()); }
+
+    // Rebuild the full handle of the element at a dense position
+    [[nodiscard]] TINY_FORCE_INLINE Handle handleAt(uint32_t densePos) const noexcept {
+        uint32_t idx = denseIDs_[densePos];
+        return Handle(idx, versions_[idx], TYPE_ID);
+    }
+
 private:
-    std::deque<T>         denseData_;   // tightly packed elements
+    std::vector<T, AlignedAlloc<T, Align>> denseData_; // tightly packed elements
     std::vector<uint32_t> denseIDs_;    // corresponding handle indices
     std::vector<uint32_t> sparse_;      // maps handle index -> dense position, UINT32_MAX = free
     std::vector<uint16_t> versions_;    // version per handle index
     std::vector<uint32_t> freeList_;    // recycled indices
+
+    // Owner links (empty until the first emplaceFor)
+    std::vector<Handle>   owners_;      // dense position -> owner handle
+    std::vector<uint32_t> ownerSparse_; // owner index -> dense position, UINT32_MAX = none
+
+    // Change tracking (empty unless trackChanges())
+    std::vector<uint32_t> changedAt_;   // dense position -> tick of the last write
+    uint32_t tick_ = 1;
+    bool tracking_ = false;
 };
 
 } // namespace Asc
\ No newline at end of file
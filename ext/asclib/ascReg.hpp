@@ -2,23 +2,136 @@
 
 #include "ascType.hpp"
 #include "ascPool.hpp"
+#include "ascCmd.hpp"
 
-#include <unordered_map>
+#include <vector>
 #include <memory>
 #include <cassert>
+#include <tuple>
 
 namespace Asc {
 
+/* Multi-pool view, joined on owner handles (see Pool::emplaceFor)
+
+Walks the smallest pool linearly and probes the rest through their owner sparse arrays
+
+    reg.view<Transform3D, MeshRender3D>().forEach([](Handle owner, Transform3D& t, MeshRender3D& m) { ... });
+
+Elements emplaced without an owner are never visited
+*/
+
+template<typename... Ts>
+class View {
+    std::tuple<Pool<Ts>*...> pools_;
+
+public:
+    explicit View(Pool<Ts>*... pools) noexcept : pools_(pools...) {}
+
+    [[nodiscard]] bool valid() const noexcept {
+        return std::apply([](auto*... p) { return ((p != nullptr) && ...); }, pools_);
+    }
+
+    // Upper bound of matches
+    [[nodiscard]] uint32_t sizeHint() const noexcept {
+        if (!valid()) return 0;
+        uint32_t n = UINT32_MAX;
+        std::apply([&](auto*... p) { ((n = p->count() < n ? p->count() : n), ...); }, pools_);
+        return n;
+    }
+
+    template<typename F>
+    void forEach(F&& f) {
+        if (!valid()) return;
+
+        // Pick the smallest pool to lead
+        forEachLead(f, leadIndex(), std::index_sequence_for<Ts...>{});
+    }
+
+    // forEach with the lead pool split across cores, same rules as Pool::parallelForEach
+    template<typename F>
+    void parallelForEach(F&& f, uint32_t grainSize = 0) {
+        if (!valid()) return;
+
+        size_t lead = leadIndex();
+        parallelLead(f, lead, grainSize, std::index_sequence_for<Ts...>{});
+    }
+
+private:
+    size_t leadIndex() const noexcept {
+        size_t lead = 0;
+        uint32_t leadCount = UINT32_MAX;
+        size_t i = 0;
+        std::apply([&](auto*... p) {
+            ((p->count() < leadCount ? (leadCount = p->count(), lead = i) : 0, ++i), ...);
+        }, pools_);
+        return lead;
+    }
+
+    template<typename F, size_t... Is>
+    void forEachLead(F& f, size_t lead, std::index_sequence<Is...> seq) {
+        ((Is == lead ? (iterate<Is>(f, seq), 0) : 0), ...);
+    }
+
+    template<typename F, size_t... Is>
+    void parallelLead(F& f, size_t lead, uint32_t grainSize, std::index_sequence<Is...> seq) {
+        ((Is == lead ? (parallelIterate<Is>(f, grainSize, seq), 0) : 0), ...);
+    }
+
+    template<size_t Lead, typename F, size_t... Is>
+    TINY_FORCE_INLINE void visit(F& f, uint32_t i, std::index_sequence<Is...>) {
+        Handle owner = std::get<Lead>(pools_)->ownerAt(i);
+        if (!owner) return;
+
+        auto ptrs = std::make_tuple(probe<Is, Lead>(owner, i)...);
+        if (!((std::get<Is>(ptrs) != nullptr) && ...)) return;
+
+        f(owner, *std::get<Is>(ptrs)...);
+    }
+
+    template<size_t Lead, typename F, size_t... Is>
+    void iterate(F& f, std::index_sequence<Is...> seq) {
+        auto* leadPool = std::get<Lead>(pools_);
+
+        const uint32_t n = leadPool->count();
+        for (uint32_t i = 0; i < n && i < leadPool->count(); ++i) visit<Lead>(f, i, seq);
+    }
+
+    template<size_t Lead, typename F, size_t... Is>
+    void parallelIterate(F& f, uint32_t grainSize, std::index_sequence<Is...> seq) {
+        auto* leadPool = std::get<Lead>(pools_);
+        using LeadT = std::remove_pointer_t<std::decay_t<decltype(leadPool)>>;
+
+        const uint32_t n = leadPool->count();
+        if (n == 0) return;
+
+        uint32_t grain = detail::chunkGrain(n, grainSize, sizeof(typename LeadT::value_type));
+        detail::parallelChunks(n, grain, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) visit<Lead>(f, i, seq);
+        });
+    }
+
+    template<size_t I, size_t Lead>
+    TINY_FORCE_INLINE auto* probe(Handle owner, uint32_t leadPos) noexcept {
+        auto* pool = std::get<I>(pools_);
+        if constexpr (I == Lead) return pool->data() + leadPos;
+        else return pool->getFor(owner);
+    }
+};
+
 class Reg {
     struct IPool {
         virtual ~IPool() noexcept = default;
         virtual void* get(Handle h) noexcept = 0;
         virtual void erase(Handle h) noexcept = 0;
+        virtual void erase(Span<const Handle> hs) noexcept = 0;
         virtual void clear() noexcept = 0;
+        virtual void nextTick() noexcept = 0;
+        virtual PoolStats stats() const noexcept = 0;
+        virtual const char* typeName() const noexcept = 0;
     };
 
     template<typename T>
-    struct PoolWrapper : IPool {
+    struct PoolWrapper final : IPool {
         Pool<T> pool;
 
         void* get(Handle h) noexcept override {
@@ -27,27 +140,50 @@ class Reg {
         void erase(Handle h) noexcept override {
             pool.erase(h);
         }
+        void erase(Span<const Handle> hs) noexcept override {
+            pool.erase(hs);
+        }
         void clear() noexcept override {
             pool.clear();
         }
+        void nextTick() noexcept override {
+            pool.nextTick();
+        }
+        PoolStats stats() const noexcept override {
+            return pool.stats();
+        }
+        const char* typeName() const noexcept override {
+            return Type::Name<T>();
+        }
     };
 
-    std::unordered_map<Type::ID, std::unique_ptr<IPool>> pools_;
+    // Type IDs are small and dense, index straight into the table (nullptr = no pool yet)
+    std::vector<std::unique_ptr<IPool>> pools_;
+
+    TINY_FORCE_INLINE IPool* rawPool(Type::ID typeID) const noexcept {
+        return typeID < pools_.size() ? pools_[typeID].get() : nullptr;
+    }
+
+    template<typename T>
+    TINY_FORCE_INLINE PoolWrapper<T>* getPool() const noexcept {
+        return static_cast<PoolWrapper<T>*>(rawPool(Type::TypeID<T>()));
+    }
 
     template<typename T>
-    TINY_FORCE_INLINE PoolWrapper<T>* getPool() noexcept {
-        auto it = pools_.find(Type::TypeID<T>());
-        return it != pools_.end() ? static_cast<PoolWrapper<T>*>(it->second.get()) : nullptr;
+    TINY_FORCE_INLINE Pool<T>* poolPtr() noexcept {
+        auto* wrapper = getPool<T>();
+        return wrapper ? &wrapper->pool : nullptr;
     }
 
     template<typename T>
     PoolWrapper<T>& ensurePool() {
-        auto id = Type::TypeID<T>();
-        auto [it, inserted] = pools_.try_emplace(id);
-        if (inserted) {
-            it->second = std::make_unique<PoolWrapper<T>>();
-        }
-        return *static_cast<PoolWrapper<T>*>(it->second.get());
+        Type::ID id = Type::TypeID<T>();
+        if (id >= pools_.size()) pools_.resize(id + 1);
+
+        std::unique_ptr<IPool>& slot = pools_[id];
+        if (!slot) slot = std::make_unique<PoolWrapper<T>>();
+
+        return *static_cast<PoolWrapper<T>*>(slot.get());
     }
 
 public:
@@ -58,6 +194,21 @@ public:
         return ensurePool<T>().pool.emplace(std::forward<Args>(args)...);
     }
 
+    template<typename T, typename... Args>
+    Handle emplaceFor(Handle owner, Args&&... args) {
+        return ensurePool<T>().pool.emplaceFor(owner, std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename... Args>
+    void emplaceN(Span<Handle> out, const Args&... args) {
+        ensurePool<T>().pool.emplaceN(out, args...);
+    }
+
+    template<typename T, typename... Args>
+    void emplaceForN(Span<const Handle> owners, Span<Handle> out, const Args&... args) {
+        ensurePool<T>().pool.emplaceForN(owners, out, args...);
+    }
+
     template<typename T>
     void reserve(uint32_t capacity) {
         ensurePool<T>().pool.reserve(capacity);
@@ -74,16 +225,57 @@ public:
         return const_cast<Reg*>(this)->get<T>(h);
     }
 
+    template<typename T>
+    [[nodiscard]] TINY_FORCE_INLINE T* getFor(Handle owner) noexcept {
+        auto* pool = getPool<T>();
+        return pool ? pool->pool.getFor(owner) : nullptr;
+    }
+
+    template<typename T>
+    [[nodiscard]] TINY_FORCE_INLINE const T* getFor(Handle owner) const noexcept {
+        return const_cast<Reg*>(this)->getFor<T>(owner);
+    }
+
+    // Stamping access for change-tracked pools (see Pool::trackChanges)
+    template<typename T>
+    TINY_FORCE_INLINE T* write(Handle h) noexcept {
+        auto* pool = getPool<T>();
+        return pool ? pool->pool.write(h) : nullptr;
+    }
+
+    template<typename T>
+    TINY_FORCE_INLINE T* writeFor(Handle owner) noexcept {
+        auto* pool = getPool<T>();
+        return pool ? pool->pool.writeFor(owner) : nullptr;
+    }
+
+    // Advance every pool's tick, once per frame
+    void nextTick() noexcept {
+        for (auto& pool : pools_) {
+            if (pool) pool->nextTick();
+        }
+    }
+
     [[nodiscard]] TINY_FORCE_INLINE void* get(Handle h) noexcept {
-        if (!h) return nullptr;
-        auto it = pools_.find(h.typeID);
-        return it != pools_.end() ? it->second->get(h) : nullptr;
+        IPool* pool = h ? rawPool(h.typeID) : nullptr;
+        return pool ? pool->get(h) : nullptr;
     }
 
     void erase(Handle h) noexcept {
-        if (!h) return;
-        auto it = pools_.find(h.typeID);
-        if (it != pools_.end()) it->second->erase(h);
+        IPool* pool = h ? rawPool(h.typeID) : nullptr;
+        if (pool) pool->erase(h);
+    }
+
+    // Mixed types are fine, each pool gets its own batch
+    void erase(Span<const Handle> hs) {
+        std::vector<std::vector<Handle>> byType(pools_.size());
+        for (Handle h : hs) {
+            if (h && h.typeID < byType.size()) byType[h.typeID].push_back(h);
+        }
+
+        for (size_t id = 0; id < byType.size(); ++id) {
+            if (!byType[id].empty() && pools_[id]) pools_[id]->erase(Span<const Handle>(byType[id]));
+        }
     }
 
     // View raw pools
@@ -95,13 +287,43 @@ public:
     template<typename T>
     [[nodiscard]] const Pool<T>& view() const {
         static Pool<T> empty;
-        auto it = pools_.find(Type::TypeID<T>());
-        return it != pools_.end()
-            ? static_cast<PoolWrapper<T>*>(it->second.get())->pool
-            : empty;
+        auto* wrapper = getPool<T>();
+        return wrapper ? wrapper->pool : empty;
+    }
+
+    // Joined view over several owned pools (missing pool = empty view)
+    template<typename A, typename B, typename... Rest>
+    [[nodiscard]] View<A, B, Rest...> view() noexcept {
+        return View<A, B, Rest...>(poolPtr<A>(), poolPtr<B>(), poolPtr<Rest>()...);
     }
 
     // Stats
+    struct PoolInfo {
+        Type::ID    typeID = 0;
+        const char* name = nullptr;
+        PoolStats   stats;
+    };
+
+    // One entry per live pool, ordered by type ID
+    [[nodiscard]] std::vector<PoolInfo> poolStats() const {
+        std::vector<PoolInfo> infos;
+        for (size_t id = 0; id < pools_.size(); ++id) {
+            if (!pools_[id]) continue;
+            infos.push_back({ static_cast<Type::ID>(id), pools_[id]->typeName(), pools_[id]->stats() });
+        }
+        return infos;
+    }
+
+    // Everything summed, the type table itself counts as sparse
+    [[nodiscard]] PoolStats totalStats() const noexcept {
+        PoolStats total;
+        for (const auto& pool : pools_) {
+            if (pool) total += pool->stats();
+        }
+        total.sparseBytes += pools_.capacity() * sizeof(pools_[0]);
+        return total;
+    }
+
     template<typename T>
     [[nodiscard]] uint32_t count() const noexcept {
         auto* p = getPool<T>();
@@ -120,7 +342,7 @@ public:
     }
 
     void clear(Type::ID typeID) noexcept {
-        pools_.erase(typeID);
+        if (typeID < pools_.size()) pools_[typeID].reset();
     }
 
     template<typename T>
@@ -128,8 +350,40 @@ public:
         clear(Type::TypeID<T>());
     }
 
-    [[nodiscard]] bool empty() const noexcept { return pools_.empty(); }
-    [[nodiscard]] size_t size() const noexcept { return pools_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] size_t size() const noexcept {
+        size_t n = 0;
+        for (const auto& pool : pools_) n += pool != nullptr;
+        return n;
+    }
+};
+
+// Deferred Reg mutations, safe to record from any thread. Handles returned are pending until flush()
+class RegCmds : public CmdQueue<Reg> {
+public:
+    template<typename T, typename... Args>
+    [[nodiscard]] Handle emplace(Args&&... args) {
+        Handle p = pending();
+        auto data = std::make_shared<T>(std::forward<Args>(args)...); // std::function wants copyable
+        push([p, data](Reg& reg, CmdQueue<Reg>& q) {
+            q.bind(p, reg.emplace<T>(std::move(*data)));
+        });
+        return p;
+    }
+
+    template<typename T, typename... Args>
+    Handle emplaceFor(Handle owner, Args&&... args) {
+        Handle p = pending();
+        auto data = std::make_shared<T>(std::forward<Args>(args)...);
+        push([p, owner, data](Reg& reg, CmdQueue<Reg>& q) {
+            q.bind(p, reg.emplaceFor<T>(q.resolve(owner), std::move(*data)));
+        });
+        return p;
+    }
+
+    void erase(Handle h) {
+        push([h](Reg& reg, CmdQueue<Reg>& q) { reg.erase(q.resolve(h)); });
+    }
 };
 
 } // namespace Asc
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <string>
 #include <functional>
+#include <type_traits>
 
 namespace Asc {
 
@@ -31,6 +34,44 @@ namespace Type {
     ID TypeID(const T&) noexcept {
         return TypeID<T>();
     }
+
+    namespace detail {
+        template<typename T>
+        const char* signature() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+    }
+
+    // Readable type name for tooling, pulled out of the compiler's function signature
+    template<typename T>
+    const char* Name() noexcept {
+        static const std::string name = [] {
+            std::string sig = detail::signature<T>();
+#if defined(_MSC_VER) && !defined(__clang__)
+            const char* open = "signature<";
+            size_t start = sig.find(open);
+            size_t end = sig.rfind(">(");
+#else
+            const char* open = "T = ";
+            size_t start = sig.find(open);
+            size_t end = sig.find_first_of(";]", start);
+#endif
+            if (start == std::string::npos || end == std::string::npos) return sig;
+            start += strlen(open);
+            if (end < start) return sig;
+
+            std::string n = sig.substr(start, end - start);
+            for (const char* prefix : { "struct ", "class " }) {
+                if (n.rfind(prefix, 0) == 0) n.erase(0, strlen(prefix));
+            }
+            return n;
+        }();
+        return name.c_str();
+    }
 };
 
 // -------------------- Handle --------------------
@@ -72,6 +113,74 @@ union Handle {
     [[nodiscard]] constexpr uint64_t raw() const noexcept { return value; }
 };
 
+// -------------------- Span --------------------
+
+/*
+Poor man's std::span (we're on C++17)
+
+Non-owning pointer + count, valid until the owner reallocates
+*/
+
+template<typename T>
+struct Span {
+    T*       ptr = nullptr;
+    uint32_t num = 0;
+
+    constexpr Span() noexcept = default;
+    constexpr Span(T* ptr, uint32_t num) noexcept : ptr(ptr), num(num) {}
+
+    template<typename Container>
+    constexpr Span(Container& c) noexcept : ptr(c.data()), num(static_cast<uint32_t>(c.size())) {}
+
+    [[nodiscard]] constexpr T* data() const noexcept { return ptr; }
+    [[nodiscard]] constexpr uint32_t size() const noexcept { return num; }
+    [[nodiscard]] constexpr size_t sizeBytes() const noexcept { return size_t(num) * sizeof(T); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return num == 0; }
+
+    [[nodiscard]] constexpr T& operator[](uint32_t i) const noexcept { return ptr[i]; }
+
+    [[nodiscard]] constexpr T* begin() const noexcept { return ptr; }
+    [[nodiscard]] constexpr T* end() const noexcept { return ptr + num; }
+
+    [[nodiscard]] constexpr Span sub(uint32_t offset, uint32_t count) const noexcept {
+        return Span(ptr + offset, count);
+    }
+};
+
+// -------------------- Content hash --------------------
+
+/*
+FNV-1a folded 8 bytes at a time, tail byte by byte. Stable across runs and platforms
+(little-endian), meant for "same data?" checks on resources, not for hash tables
+
+Chain calls through seed to hash several buffers as one
+*/
+
+inline constexpr uint64_t HASH_SEED = 1469598103934665603ULL;
+
+inline uint64_t hashBytes(const void* data, size_t size, uint64_t seed = HASH_SEED) noexcept {
+    constexpr uint64_t prime = 1099511628211ULL;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    uint64_t h = seed;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        h = (h ^ word) * prime;
+        h ^= h >> 29; // Spread the high bits back down, plain FNV on words barely mixes them
+    }
+    for (; i < size; ++i) h = (h ^ bytes[i]) * prime;
+
+    return h;
+}
+
+template<typename T>
+inline uint64_t hashValue(const T& value, uint64_t seed = HASH_SEED) noexcept {
+    static_assert(std::is_trivially_copyable_v<T>, "hashValue is for plain data");
+    return hashBytes(&value, sizeof(T), seed);
+}
+
 }
 
 namespace std {
@@ -62,6 +62,8 @@ public:
     VkPhysicalDeviceMemoryProperties pMemProps{};
     VkPhysicalDeviceFeatures pFeatures{};
 
+    bool multiDrawIndirect = false; // multiDrawIndirect + drawIndirectFirstInstance, enabled when supported
+
     // Helper functions
     size_t alignSize(size_t original, size_t minAlignment) const {
         size_t alignedSize = original;
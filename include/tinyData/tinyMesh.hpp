@@ -182,6 +182,15 @@ struct tinyMesh {
         ABmin_ = glm::min(ABmin_, submesh.ABmin);
         ABmax_ = glm::max(ABmax_, submesh.ABmax);
 
+        // Content hash grows with every submesh, CPU data is gone after vkCreate
+        auto mix = [&](const auto& v) { hash_ = Asc::hashBytes(v.data(), v.size() * sizeof(v[0]), hash_); };
+        mix(submesh.vstaticData);
+        mix(submesh.indxData);
+        mix(submesh.vriggedData);
+        mix(submesh.vcolorData);
+        mix(submesh.vmrphsData);
+        hash_ = Asc::hashValue(submesh.vrtxTypes, hash_);
+
         submeshes_.push_back(std::move(submesh));
         return submeshes_.size() - 1;
     }
@@ -375,6 +384,9 @@ struct tinyMesh {
     Submesh* submesh(size_t index) { return index < submeshes_.size() ? &submeshes_[index] : nullptr; }
     const Submesh* submesh(size_t index) const { return const_cast<tinyMesh*>(this)->submesh(index); }
 
+    // Geometry content hash, identical imports hash the same across sessions
+    uint64_t hash() const noexcept { return hash_; }
+
     const glm::vec3& ABmin() const { return ABmin_; }
     const glm::vec3& ABmax() const { return ABmax_; }
     void setABmin(const glm::vec3& abMin) { ABmin_ = abMin; }
@@ -391,6 +403,8 @@ private:
     glm::vec3 ABmin_ = glm::vec3(std::numeric_limits<float>::max());
     glm::vec3 ABmax_ = glm::vec3(std::numeric_limits<float>::lowest());
 
+    uint64_t hash_ = Asc::HASH_SEED;
+
     tinyVk::DescSet mrphDltsDescSet_;
     tinyVk::DataBuffer mrphDltsBuffer_;
 
@@ -8,6 +8,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include "ascType.hpp"
+
 struct tinyBone {
     std::string name;
 
@@ -34,4 +36,16 @@ struct tinySkeleton {
         bones.push_back(bone);
         return static_cast<uint32_t>(bones.size() - 1);
     }
+
+    // Content hash (names, hierarchy, bind matrices), computed on the spot
+    uint64_t hash() const noexcept {
+        uint64_t h = Asc::HASH_SEED;
+        for (const tinyBone& bone : bones) {
+            h = Asc::hashBytes(bone.name.data(), bone.name.size(), h);
+            h = Asc::hashValue(bone.parent, h);
+            h = Asc::hashValue(bone.bindInverse, h);
+            h = Asc::hashValue(bone.bindPose, h);
+        }
+        return h;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "ascPool.hpp"
+
+#include <glm/glm.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+// Per instance vertex data (binding 1), see RENDER RULES in tinyDrawable.hpp
+struct tinyInstaData {
+    glm::mat4 model = glm::mat4(1.0f); // Model matrix
+    glm::uvec4 other = glm::uvec4(0); // Additional data
+};
+
+/* Retained list
+
+Draws that outlive the frame: add() once, move() when the model changes, remove() when
+done, submit() the list every frame. That costs the list's groups plus the instances that
+changed since the same frame slot last held it, not the instance count
+
+One group per (mesh, cell): instances are binned by where the model puts them, so a group's
+bounds stay local and submit() can cull it as a whole. Every submesh draws the whole group
+(no per-submesh culling here). Instances only carry the model, skinned/morphed content
+changes every frame anyway and stays on submit(Entry)
+
+Nothing in here touches Vulkan: tinyDrawable hands Slot::upload() the mapped range, so the
+bookkeeping builds and runs on the host alone (tests/drawListTest.cpp)
+*/
+class tinyDrawList {
+public:
+    explicit tinyDrawList(float cellSize = 64.0f) noexcept;
+
+    Asc::Handle add(Asc::Handle mesh, const glm::mat4& model);
+    void move(Asc::Handle item, const glm::mat4& model) noexcept;
+    void remove(Asc::Handle item) noexcept;
+    void clear() noexcept;
+
+    Asc::Handle mesh(Asc::Handle item) const noexcept;
+    uint32_t count() const noexcept { return items_.count(); }
+    uint32_t capacity() const noexcept { return capacity_; } // Instances it took in the buffer at the last submit
+
+    uint32_t rangeSize(); // Instances the list takes in a slot, lays the groups out again first if one outgrew its room
+
+    /* Frame slot
+
+    What one slot of the instance buffer holds, the lists in submit order. A list that comes
+    back to the same spot in the same layout only writes what changed since the slot last had it
+    */
+    class Slot {
+    public:
+        void begin() noexcept { count_ = 0; }
+
+        // Bring the slot's copy of list (range, at base in the slot) up to date, keep = how many slots
+        // there are. Returns whether only the changes went in
+        bool upload(tinyDrawList& list, tinyInstaData* range, uint32_t base, uint32_t keep);
+
+        // Spots no list took this frame hold other data by now, nothing to diff against there
+        void end() { records_.resize(count_); }
+
+    private:
+        struct Record {
+            uint64_t list = 0;
+            uint64_t layout = 0;
+            uint64_t version = 0;
+            uint32_t base = 0;
+        };
+        std::vector<Record> records_;
+        uint32_t count_ = 0;
+    };
+
+    // Every non empty group's run in the range, fn(mesh, offset, count). What submit() draws
+    template<typename Fn>
+    void forEachRun(Fn&& fn) const {
+        for (const Group& group : groups_) {
+            if (!group.instaData.empty()) fn(group.mesh, group.base, static_cast<uint32_t>(group.instaData.size()));
+        }
+    }
+
+private:
+    friend class tinyDrawable;
+
+    struct Item {
+        uint32_t group = 0;
+        uint32_t index = 0;
+    };
+
+    struct Group {
+        Asc::Handle mesh;
+        glm::ivec3 cell = glm::ivec3(0);
+        uint32_t base = 0; // Into the list's range
+        uint32_t capacity = 0;
+        std::vector<tinyInstaData> instaData;
+        std::vector<Asc::Handle>   items; // Parallel to instaData, for swap-remove fixups
+
+        // World box of every instance, rebuilt by submit() when dirty. min > max = unbounded, never culled
+        glm::vec3 boundsMin = glm::vec3(0.0f);
+        glm::vec3 boundsMax = glm::vec3(0.0f);
+        bool boundsDirty = true;
+    };
+
+    struct GroupKey {
+        Asc::Handle mesh;
+        glm::ivec3 cell;
+        bool operator==(const GroupKey& other) const noexcept { return mesh == other.mesh && cell == other.cell; }
+    };
+    struct GroupKeyHash {
+        size_t operator()(const GroupKey& key) const noexcept {
+            size_t h = std::hash<Asc::Handle>()(key.mesh);
+            for (int i = 0; i < 3; ++i) h = h * 0x9E3779B97F4A7C15ull + static_cast<uint32_t>(key.cell[i]);
+            return h;
+        }
+    };
+
+    Asc::Pool<Item> items_;
+    std::vector<Group> groups_;
+    std::unordered_map<GroupKey, uint32_t, GroupKeyHash> groupMap_;
+    uint32_t capacity_ = 0;
+    float cellSize_ = 64.0f;
+    bool stale_ = false; // Some group outgrew its capacity, relayout() before the next submit
+
+    // What frame slots compare against to tell a delta from a full copy
+    uint64_t id_ = 0;
+    uint64_t layout_ = 0;           // Bumped whenever group bases move
+    std::vector<Item> log_;         // Changed instances, oldest first
+    uint64_t logBase_ = 0;          // Version of log_[0], logBase_ + log_.size() is the current one
+    std::vector<uint64_t> submits_; // Versions of the last few submits, the log keeps what they haven't seen
+
+    glm::ivec3 cellOf(const glm::mat4& model) const noexcept;
+    void attach(Asc::Handle item, Asc::Handle mesh, const glm::mat4& model);
+    void detach(const Item& at) noexcept; // Swap-remove, the item handle stays
+
+    void changed(uint32_t group, uint32_t index);
+    void relayout();
+    void submitted(uint32_t keep);
+    void refreshBounds(Group& group, const glm::vec3& meshMin, const glm::vec3& meshMax) noexcept;
+};
@@ -7,6 +7,9 @@
 #include "tinyData/tinyMesh.hpp"
 #include "tinyData/tinyMaterial.hpp"
 #include "tinyData/tinyTexture.hpp"
+#include "tinyData/tinyCamera.hpp"
+
+#include "tinyEngine/tinyDrawList.hpp"
 
 /* RENDER RULES:
 
@@ -24,10 +27,11 @@ Instance Data: {
 
 class tinyDrawable {
 public:
-    static constexpr size_t MAX_INSTANCES = 100000; // 8mb - more than enough
+    static constexpr size_t MAX_INSTANCES = 131072; // 10mb - retained lists keep some headroom
     static constexpr size_t MAX_MATERIALS = 10000;  // 0.96mb - more than enough
     static constexpr size_t MAX_BONES     = 102400; // 6.5mb ~ 400 model x 256 bones x 64 bytes (mat4) - plenty
     static constexpr size_t MAX_MORPH_WS  = 65536;  // Morph WEIGHTS, not Delta, 65536 x 4 bytes = 256kb, literally invisible
+    static constexpr size_t MAX_DRAWS     = 65536;  // One per SubmeshGroup, 1.25mb of commands + 3mb of DrawData
 
     static std::vector<VkVertexInputBindingDescription> bindingDesc() noexcept;
     static std::vector<VkVertexInputAttributeDescription> attributeDescs() noexcept;
@@ -43,26 +47,18 @@ public:
         VkDeviceSize unaligned = 0; // Actual data size to copy
     };
 
-    struct InstaData {
-        glm::mat4 model = glm::mat4(1.0f); // Model matrix
-        glm::uvec4 other = glm::uvec4(0); // Additional data
+    using InstaData = tinyInstaData;
+
+    struct DrawData { // Per draw, what used to be push constants. Read as draws[drawBase + gl_DrawID]
+        glm::uvec4 data0 = glm::uvec4(0); // vrtxFlags, vrtxCount, mrphTargetCount, material index
+        glm::uvec4 data1 = glm::uvec4(0); // vstatic, vrigged, vcolor, vmrphs offsets
+        glm::uvec4 data2 = glm::uvec4(0); // x: mrphTargetCount
     };
 
     struct Entry {
         Asc::Handle mesh;
         size_t submesh;
 
-        inline Asc::Handle hash() const {
-            Asc::Handle h{};
-            uint64_t x = mesh.raw();
-
-            // A simple 64-bit mixing function (very cheap, very good)
-            x ^= uint64_t(submesh) + 0x9e3779b97f4a7c15ULL + (x << 6) + (x >> 2);
-
-            h.value = x;
-            return h;
-        }
-
         glm::mat4 model = glm::mat4(1.0f);
 
         // Additional data
@@ -80,26 +76,21 @@ public:
 
     struct SubmeshGroup {
         uint32_t submesh = 0;
-        std::vector<InstaData> instaData;
-
-        inline size_t push(const InstaData& data) {
-            instaData.push_back(data);
-            return instaData.size() - 1;
-        }
-
-        inline void clear() { instaData.clear(); }
-        inline size_t size() const { return instaData.size(); }
-        inline size_t sizeBytes() const { return instaData.size() * sizeof(InstaData); }
 
         // Calculated during finalize
         uint32_t instaOffset = 0;
         uint32_t instaCount  = 0;
+
+        bool retained = false; // Range of a List, already in the buffer
     };
 
     struct MeshGroup {
         Asc::Handle mesh;
         std::vector<size_t> submeshGroupIndices;
-        std::unordered_map<size_t, size_t> submeshGroupMap; // Submesh index -> SubmeshGroup index
+
+        // Calculated during finalize, one command per submesh group in the same order
+        uint32_t drawOffset = 0;
+        uint32_t drawCount  = 0;
     };
 
     struct ShaderGroup {
@@ -113,6 +104,63 @@ public:
         uint32_t skinCount = 0;
     };
 
+private:
+    /* Sort keys
+
+    Submits only append, finalize sorts and cuts the runs into SubmeshGroups:
+
+        63..32 mesh index | 31..16 mesh version | 15..0 submesh
+
+    The key alone names the mesh again, so nothing is looked up until there's one run per
+    (mesh, submesh). The sort is stable and buckets merge in index order, instances keep
+    submit order inside their group
+    */
+    struct Keyed {
+        uint64_t key = 0;
+        uint32_t insta = 0;  // Into the bucket's instaData_
+        uint32_t bucket = 0; // Into buckets_, fills what would be padding anyway
+    };
+
+    static uint64_t sortKey(Asc::Handle meshHandle, uint32_t submesh) noexcept {
+        return uint64_t(meshHandle.index) << 32 | uint64_t(meshHandle.version) << 16 | submesh;
+    }
+
+public:
+    /* Submission bucket
+
+    Where submits land. Nothing in here is shared, so every worker can fill its own while
+    the others do the same; finalize merges them in index order. Hand out contiguous slices
+    of one serial order and the batches come out as if a single thread did all of it
+
+    Skin palettes and morph weights are deduplicated per bucket and only read in finalize,
+    what the entries point at has to stay alive until then
+    */
+    class Bucket {
+    public:
+        void submit(const Entry& entry) noexcept;
+
+    private:
+        friend class tinyDrawable;
+
+        uint32_t index_ = 0; // In buckets_
+
+        std::vector<Keyed>     keyed_;
+        std::vector<InstaData> instaData_; // other.x / other.z hold local skin / morph refs until the merge
+
+        std::vector<Entry::SkeleData> skins_;
+        std::vector<Entry::MorphData> morphs_;
+        std::unordered_map<Asc::Handle, uint32_t> skinMap_; // Skeleton node -> skins_ index
+        std::unordered_map<Asc::Handle, uint32_t> mrphMap_; // Node -> morphs_ index
+
+        // Filled by finalize, local ref -> buffer offset
+        std::vector<uint32_t> skinOffsets_;
+        std::vector<uint32_t> mrphOffsets_;
+
+        void clear() noexcept;
+    };
+
+    using List = tinyDrawList; // Retained list, see tinyDrawList.hpp
+
 // ---------------------------------------------------------------
 
     tinyDrawable() noexcept = default;
@@ -148,6 +196,10 @@ public:
     VkDescriptorSet mrphWsDescSet() const noexcept { return mrphWsDescSet_; } // Set 5
     VkDescriptorSetLayout mrphWsDescLayout() const noexcept { return mrphWsDescLayout_; }
 
+    VkBuffer drawBuffer() const noexcept { return drawBuffer_; } // VkDrawIndexedIndirectCommand[]
+    VkDescriptorSet drawDescSet() const noexcept { return drawDescSet_; } // Set 6, DrawData[]
+    VkDescriptorSetLayout drawDescLayout() const noexcept { return drawDescLayout_; }
+
     uint32_t matIndex(Asc::Handle matHandle) const noexcept {
         auto it = dataMap_.find(matHandle);
         return (it != dataMap_.end()) ? it->second : 0;
@@ -157,11 +209,15 @@ public:
     Size_x1 matSize_x1() const noexcept { return matSize_x1_; }
     Size_x1 skinSize_x1() const noexcept { return skinSize_x1_; }
     Size_x1 mrphWsSize_x1() const noexcept { return mrphWsSize_x1_; }
+    Size_x1 drawSize_x1() const noexcept { return drawSize_x1_; }
+    Size_x1 drawDataSize_x1() const noexcept { return drawDataSize_x1_; }
 
     inline VkDeviceSize instaOffset(uint32_t frameIndex) const noexcept { return frameIndex * instaSize_x1_.aligned; }
     inline VkDeviceSize matOffset(uint32_t frameIndex) const noexcept { return frameIndex * matSize_x1_.aligned; }
     inline VkDeviceSize skinOffset(uint32_t frameIndex) const noexcept { return frameIndex * skinSize_x1_.aligned; }
     inline VkDeviceSize mrphWsOffset(uint32_t frameIndex) const noexcept { return frameIndex * mrphWsSize_x1_.aligned; }
+    inline VkDeviceSize drawOffset(uint32_t frameIndex) const noexcept { return frameIndex * drawSize_x1_.aligned; }
+    inline VkDeviceSize drawDataOffset(uint32_t frameIndex) const noexcept { return frameIndex * drawDataSize_x1_.aligned; }
 
 
     VkDescriptorSetLayout vrtxExtLayout() const noexcept { return vrtxExtLayout_; }
@@ -170,9 +226,14 @@ public:
 // --------------------------- Bacthking --------------------------
 
     void startFrame(uint32_t frameIndex) noexcept;
-    void submit(const Entry& entry) noexcept;
+    void submit(const Entry& entry) noexcept; // Main thread, merges ahead of every bucket()
+    void submit(List& list, const tinyCamera* camera = nullptr) noexcept; // Retained ranges go first, submit(Entry) instances after. No camera = no culling
     void finalize() noexcept;
 
+    // Worker buckets for this frame, open them on the main thread before going parallel
+    void openBuckets(uint32_t count);
+    Bucket& bucket(uint32_t index) noexcept { return *buckets_[index + 1]; }
+
     const std::vector<ShaderGroup>& shaderGroups() const noexcept { return shaderGroups_; }
     const std::vector<MeshGroup>& meshGroups() const noexcept { return meshGroups_; }
     const std::vector<SubmeshGroup>& submeshGroups() const noexcept { return submeshGroups_; }
@@ -208,15 +269,71 @@ private:
     std::vector<MeshGroup>    meshGroups_;
     std::vector<SubmeshGroup> submeshGroups_;
 
-    // Runtime data
-    uint32_t skinCount_ = 0;
-    uint32_t mrphWsCount_ = 0;
+    /* Frame arena
+
+    Bump allocator over this frame's slot of a persistently mapped buffer. What it hands out
+    is the final spot, the GPU reads whatever gets written there: no staging, no copyData
+    Reset by startFrame, full = nullptr, the caller drops what didn't fit
+
+    The memory may be write-combined, write whole elements and never read them back
+    */
+    template<typename T>
+    class Arena {
+    public:
+        void reset(void* slot, uint32_t capacity) noexcept {
+            base_ = static_cast<T*>(slot);
+            capacity_ = slot ? capacity : 0;
+            used_ = 0;
+        }
+
+        T* alloc(uint32_t count, uint32_t& offset) noexcept {
+            if (count > capacity_ - used_) return nullptr;
+            offset = used_;
+            used_ += count;
+            return base_ + offset;
+        }
+
+        uint32_t used() const noexcept { return used_; }
+        uint32_t left() const noexcept { return capacity_ - used_; }
+
+    private:
+        T* base_ = nullptr;
+        uint32_t capacity_ = 0;
+        uint32_t used_ = 0;
+    };
+
+    Arena<InstaData> instaArena_; // Retained lists first, then the sorted runs
+    Arena<glm::mat4> skinArena_;
+    Arena<float>     mrphWsArena_;
+    Arena<VkDrawIndexedIndirectCommand> drawArena_;
+    Arena<DrawData>  drawDataArena_; // Lockstep with drawArena_, command i reads DrawData i
+
+    static constexpr uint32_t NO_RANGE = UINT32_MAX; // Skin/morph that didn't fit, the instance draws without
 
     std::vector<tinyMaterial::Data> matData_;
     std::vector<SkinRange> skinRanges_;
 
     std::unordered_map<Asc::Handle, size_t> batchMap_;
     std::unordered_map<Asc::Handle, size_t> dataMap_;
+    std::unordered_map<Asc::Handle, uint32_t> mrphMap_; // Node -> morph offset, apart since a skeleton node can morph too
+
+    size_t shaderGroupFor(Asc::Handle materialHandle);
+    size_t meshGroupFor(size_t shaderGroupIdx, Asc::Handle meshHandle);
+
+    // [0] takes submit(Entry), [1..bucketCount_] the workers'. Pointers so a bucket never moves
+    std::vector<std::unique_ptr<Bucket>> buckets_;
+    uint32_t bucketCount_ = 0;
+
+    uint32_t skinOffsetFor(const Entry::SkeleData& skeleData);
+    uint32_t mrphOffsetFor(const Entry::MorphData& morphData);
+
+    // Sort keys and the merge (see Keyed)
+    std::vector<Keyed>     keyed_;
+    std::vector<Keyed>     keyedSwap_; // Radix ping-pong
+
+    static void sortKeyed(std::vector<Keyed>& keyed, std::vector<Keyed>& swap) noexcept;
+
+    std::vector<List::Slot> listSlots_; // Per frame slot, what its lists left in the instance buffer
 
     // Instances (runtime)
     tinyVk::DataBuffer instaBuffer_;
@@ -252,6 +369,15 @@ private:
     tinyVk::DataBuffer  mrphWsBuffer_;
     Size_x1             mrphWsSize_x1_;
 
+    // Draws (runtime)
+    tinyVk::DataBuffer  drawBuffer_;
+    Size_x1             drawSize_x1_;
+    tinyVk::DescSLayout drawDescLayout_;
+    tinyVk::DescPool    drawDescPool_;
+    tinyVk::DescSet     drawDescSet_;
+    tinyVk::DataBuffer  drawDataBuffer_;
+    Size_x1             drawDataSize_x1_;
+
 // ==== Static default stuff ====
 
     // Vertex extension
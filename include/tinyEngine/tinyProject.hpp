@@ -25,6 +25,11 @@ public:
 
     void addSceneInstance(Asc::Handle fromHandle, Asc::Handle toHandle, Asc::Handle parentHandle = Asc::Handle());
 
+    // Binary scene snapshots (rtSnapshot.hpp). Resources are matched by content hash against
+    // what's already in the registry, load the models/scripts first
+    bool saveScene(Asc::Handle sceneHandle, const std::string& path);
+    Asc::Handle loadScene(const std::string& path, Asc::Handle parentFolder = Asc::Handle()); // Returns scene handle
+
     // Descriptor accessors
 
     // Only need the active 3
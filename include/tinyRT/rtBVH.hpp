@@ -0,0 +1,277 @@
+#pragma once
+
+#include "ascType.hpp"
+#include "tinyCamera.hpp"
+
+#include <cfloat>
+#include <vector>
+
+namespace tinyRT {
+
+struct AABB {
+    glm::vec3 min{  FLT_MAX };
+    glm::vec3 max{ -FLT_MAX };
+
+    AABB() noexcept = default;
+    AABB(const glm::vec3& min, const glm::vec3& max) noexcept : min(min), max(max) {}
+
+    // Local box through a model matrix, same center/half-extent math as tinyCamera::collideAABB
+    static AABB transform(const glm::vec3& abMin, const glm::vec3& abMax, const glm::mat4& model) noexcept {
+        glm::vec3 center = glm::vec3(model * glm::vec4((abMin + abMax) * 0.5f, 1.0f));
+
+        glm::mat3 rs(model);
+        glm::vec3 half = glm::mat3(glm::abs(rs[0]), glm::abs(rs[1]), glm::abs(rs[2])) * ((abMax - abMin) * 0.5f);
+        return AABB(center - half, center + half);
+    }
+
+    [[nodiscard]] bool valid() const noexcept { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+
+    [[nodiscard]] glm::vec3 center() const noexcept { return (min + max) * 0.5f; }
+    [[nodiscard]] glm::vec3 half() const noexcept { return (max - min) * 0.5f; }
+
+    [[nodiscard]] float area() const noexcept { // Half surface area, all SAH needs
+        glm::vec3 d = max - min;
+        return d.x * d.y + d.y * d.z + d.z * d.x;
+    }
+
+    [[nodiscard]] AABB merged(const AABB& o) const noexcept { return AABB(glm::min(min, o.min), glm::max(max, o.max)); }
+    [[nodiscard]] AABB grown(const glm::vec3& by) const noexcept { return AABB(min - by, max + by); }
+
+    [[nodiscard]] bool contains(const AABB& o) const noexcept {
+        return glm::all(glm::lessThanEqual(min, o.min)) && glm::all(glm::greaterThanEqual(max, o.max));
+    }
+
+    [[nodiscard]] bool overlaps(const AABB& o) const noexcept {
+        return glm::all(glm::lessThanEqual(min, o.max)) && glm::all(glm::greaterThanEqual(max, o.min));
+    }
+
+    [[nodiscard]] bool overlapsSphere(const glm::vec3& c, float r) const noexcept {
+        glm::vec3 d = c - glm::clamp(c, min, max);
+        return glm::dot(d, d) <= r * r;
+    }
+
+    // Slab test, t of the entry point (0 when starting inside)
+    [[nodiscard]] bool ray(const glm::vec3& origin, const glm::vec3& invDir, float maxT, float& t) const noexcept {
+        glm::vec3 t0 = (min - origin) * invDir;
+        glm::vec3 t1 = (max - origin) * invDir;
+        glm::vec3 tNear = glm::min(t0, t1), tFar = glm::max(t0, t1);
+
+        float enter = glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.0f));
+        float exit  = glm::min(glm::min(tFar.x, tFar.y), glm::min(tFar.z, maxT));
+        if (enter > exit) return false;
+
+        t = enter;
+        return true;
+    }
+
+    enum class Side { Outside, Intersect, Inside };
+
+    [[nodiscard]] Side frustum(const tinyCamera::Plane planes[6]) const noexcept {
+        glm::vec3 c = center(), h = half();
+
+        Side side = Side::Inside;
+        for (int i = 0; i < 6; ++i) {
+            glm::vec3 n = glm::vec3(planes[i].eq);
+            float radius = glm::dot(h, glm::abs(n));
+            float distance = glm::dot(n, c) + planes[i].eq.w;
+
+            if (distance + radius < 0.0f) return Side::Outside;
+            if (distance - radius < 0.0f) side = Side::Intersect;
+        }
+        return side;
+    }
+};
+
+/* BVH
+
+Dynamic AABB tree (the Box2D kind): leaves are proxies, internal nodes are picked by
+surface area on insert and kept balanced with AVL rotations, so the height stays ~log n
+no matter the insert order
+
+Leaves carry a fat box (tight box + margin). Refit only touches the tree when the tight
+box pokes out of it, so things jiggling in place cost a containment check
+
+Queries hand every overlapping owner to f(Asc::Handle), leaf tests use the tight box
+
+Leaves carry a tag mask, internal nodes the union of their children's. A frustum query with
+a mask skips whole subtrees that have nothing it wants
+*/
+
+class BVH {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    static constexpr uint32_t ALL_TAGS = UINT32_MAX;
+
+    uint32_t insert(Asc::Handle owner, const AABB& box, uint32_t tags = ALL_TAGS);
+    void remove(uint32_t proxy) noexcept;
+    bool refit(uint32_t proxy, const AABB& box); // True if the leaf had to move in the tree
+    void setTags(uint32_t proxy, uint32_t tags) noexcept;
+    void clear() noexcept;
+
+    [[nodiscard]] Asc::Handle owner(uint32_t proxy) const noexcept { return proxy < nodes_.size() ? nodes_[proxy].owner : Asc::Handle(); }
+    [[nodiscard]] const AABB& bounds(uint32_t proxy) const noexcept { return nodes_[proxy].tight; }
+    [[nodiscard]] uint32_t tags(uint32_t proxy) const noexcept { return nodes_[proxy].tags; }
+
+    [[nodiscard]] uint32_t count() const noexcept { return leafCount_; }
+    [[nodiscard]] int32_t height() const noexcept { return root_ != NONE ? nodes_[root_].height : 0; }
+
+    template<typename F> void queryBox(const AABB& box, F&& f) const;
+    template<typename F> void querySphere(const glm::vec3& center, float radius, F&& f) const;
+    template<typename F> void queryFrustum(const tinyCamera::Plane planes[6], F&& f, uint32_t mask = ALL_TAGS) const;
+
+    // Closest hit within maxDist, filter(owner) can skip candidates (eg. the caster itself)
+    template<typename Filter>
+    Asc::Handle raycast(const glm::vec3& origin, const glm::vec3& dir, float maxDist, float* hitDist, Filter&& filter) const;
+    Asc::Handle raycast(const glm::vec3& origin, const glm::vec3& dir, float maxDist = FLT_MAX, float* hitDist = nullptr) const {
+        return raycast(origin, dir, maxDist, hitDist, [](Asc::Handle) { return true; });
+    }
+
+private:
+    struct Node {
+        AABB box;   // Fat for leaves, union of the children otherwise
+        AABB tight; // Leaves only, what queries test against
+        Asc::Handle owner;
+        uint32_t tags = 0; // Leaf's own, union of the children otherwise
+
+        uint32_t parent = NONE;
+        uint32_t child1 = NONE;
+        uint32_t child2 = NONE; // Doubles as the free list link
+        int32_t  height = 0;    // Leaf = 0, free = -1
+
+        [[nodiscard]] bool leaf() const noexcept { return child1 == NONE; }
+    };
+
+    std::vector<Node> nodes_;
+    uint32_t root_ = NONE;
+    uint32_t free_ = NONE;
+    uint32_t leafCount_ = 0;
+
+    // AVL height stays under ~1.44 log2(n), 64 levels is far beyond any scene
+    static constexpr uint32_t STACK = 128;
+
+    uint32_t allocNode();
+    void freeNode(uint32_t i) noexcept;
+
+    void insertLeaf(uint32_t leaf);
+    void removeLeaf(uint32_t leaf) noexcept;
+    uint32_t balance(uint32_t a) noexcept;
+
+    static AABB fatten(const AABB& box) noexcept;
+};
+
+template<typename F>
+void BVH::queryBox(const AABB& box, F&& f) const {
+    if (root_ == NONE) return;
+
+    uint32_t stack[STACK];
+    uint32_t top = 0;
+    stack[top++] = root_;
+
+    while (top) {
+        const Node& n = nodes_[stack[--top]];
+        if (!n.box.overlaps(box)) continue;
+
+        if (n.leaf()) {
+            if (n.tight.overlaps(box)) f(n.owner);
+            continue;
+        }
+        stack[top++] = n.child1;
+        stack[top++] = n.child2;
+    }
+}
+
+template<typename F>
+void BVH::querySphere(const glm::vec3& center, float radius, F&& f) const {
+    if (root_ == NONE) return;
+
+    uint32_t stack[STACK];
+    uint32_t top = 0;
+    stack[top++] = root_;
+
+    while (top) {
+        const Node& n = nodes_[stack[--top]];
+        if (!n.box.overlapsSphere(center, radius)) continue;
+
+        if (n.leaf()) {
+            if (n.tight.overlapsSphere(center, radius)) f(n.owner);
+            continue;
+        }
+        stack[top++] = n.child1;
+        stack[top++] = n.child2;
+    }
+}
+
+template<typename F>
+void BVH::queryFrustum(const tinyCamera::Plane planes[6], F&& f, uint32_t mask) const {
+    if (root_ == NONE) return;
+
+    // High bit = parent was fully inside, the whole subtree goes without tests
+    constexpr uint32_t INSIDE = 0x80000000u;
+
+    uint32_t stack[STACK];
+    uint32_t top = 0;
+    stack[top++] = root_;
+
+    while (top) {
+        const uint32_t item = stack[--top];
+        const Node& n = nodes_[item & ~INSIDE];
+        uint32_t flag = item & INSIDE;
+        if (!(n.tags & mask)) continue;
+
+        if (!flag) {
+            AABB::Side side = n.box.frustum(planes);
+            if (side == AABB::Side::Outside) continue;
+            if (side == AABB::Side::Inside) flag = INSIDE;
+        }
+
+        if (n.leaf()) {
+            if (flag || n.tight.frustum(planes) != AABB::Side::Outside) f(n.owner);
+            continue;
+        }
+        stack[top++] = n.child1 | flag;
+        stack[top++] = n.child2 | flag;
+    }
+}
+
+template<typename Filter>
+Asc::Handle BVH::raycast(const glm::vec3& origin, const glm::vec3& dir, float maxDist, float* hitDist, Filter&& filter) const {
+    if (root_ == NONE) return Asc::Handle();
+
+    float len = glm::length(dir);
+    if (len <= 0.0f) return Asc::Handle();
+
+    const glm::vec3 d = dir / len;
+    const glm::vec3 invDir = 1.0f / d;
+
+    Asc::Handle best;
+    float bestT = maxDist;
+
+    uint32_t stack[STACK];
+    uint32_t top = 0;
+    stack[top++] = root_;
+
+    while (top) {
+        const Node& n = nodes_[stack[--top]];
+
+        float t;
+        if (!n.box.ray(origin, invDir, bestT, t)) continue;
+
+        if (n.leaf()) {
+            if (n.tight.ray(origin, invDir, bestT, t) && filter(n.owner)) {
+                best = n.owner;
+                bestT = t;
+            }
+            continue;
+        }
+        stack[top++] = n.child1;
+        stack[top++] = n.child2;
+    }
+
+    if (best && hitDist) *hitDist = bestT;
+    return best;
+}
+
+}
+
+using rtAABB = tinyRT::AABB;
+using rtBVH = tinyRT::BVH;
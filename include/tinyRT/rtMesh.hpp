@@ -2,6 +2,8 @@
 
 #include "tinyMesh.hpp"
 
+#include <memory>
+
 namespace tinyRT {
 
 /* Morph Weight explanation:
@@ -24,6 +26,13 @@ Mesh {
 
 When assigning weights to MeshRender3D, user need to provide the full flat array of weights.
 
+Static meshes are retained by the drawable (tinyDrawable::List) instead of culled and
+submitted every frame, moving one only rewrites its instance. Skeleton or morph weights
+keep a mesh on the per-frame path regardless
+
+Both arrays are shared between copies, mrphWeights() (non-const) detaches a private weight
+array on first use. Untouched instances keep pointing at the source's
+
 */
 
 struct MeshRender3D {
@@ -35,16 +44,17 @@ struct MeshRender3D {
 
         // Mesh-level morph targets (shared across all submeshes)
         uint32_t meshMorphCount = static_cast<uint32_t>(mesh->mrphTargetCount());
-        mrphWs_.resize(meshMorphCount, 0.0f);
+        if (meshMorphCount || mrphWs_) mrphWeights().resize(meshMorphCount, 0.0f);
 
         // For each submesh, store reference to the same mesh-level morph targets
-        subMrphs_.clear();
+        auto subMrphs = std::make_shared<std::vector<SubMorph>>();
         for (size_t subIdx = 0; subIdx < mesh->submeshes().size(); ++subIdx) {
             SubMorph sm;
             sm.offset = 0;  // All submeshes reference the same mesh-level weights
             sm.count = meshMorphCount;  // All submeshes use all mesh-level targets
-            subMrphs_.push_back(sm);
+            subMrphs->push_back(sm);
         }
+        subMrphs_ = std::move(subMrphs);
 
         return *this;
     }
@@ -52,7 +62,9 @@ struct MeshRender3D {
     MeshRender3D& copy(const MeshRender3D* other) noexcept {
         meshHandle_ = other->meshHandle_;
         skeleNodeHandle_ = other->skeleNodeHandle_;
+        static_ = other->static_;
 
+        // Shared, see mrphWeights()
         mrphWs_ = other->mrphWs_;
         subMrphs_ = other->subMrphs_;
         return *this;
@@ -63,29 +75,48 @@ struct MeshRender3D {
         return *this;
     }
 
+    MeshRender3D& setStatic(bool isStatic) noexcept {
+        static_ = isStatic;
+        return *this;
+    }
+
     Asc::Handle meshHandle() const noexcept { return meshHandle_; }
     Asc::Handle skeleNodeHandle() const noexcept { return skeleNodeHandle_; }
+    bool isStatic() const noexcept { return static_; }
 
     struct SubMorph {
         uint32_t offset = 0;
         uint32_t count  = 0;
     };
 
-    std::vector<float>& mrphWeights() noexcept { return mrphWs_; }
-    const std::vector<float>& mrphWeights() const noexcept { return mrphWs_; }
+    // Writable, detaches a shared weight array. Read through cMrphWeights() to keep sharing
+    std::vector<float>& mrphWeights() {
+        if (!mrphWs_) mrphWs_ = std::make_shared<std::vector<float>>();
+        else if (mrphWs_.use_count() > 1) mrphWs_ = std::make_shared<std::vector<float>>(*mrphWs_);
+        return *mrphWs_;
+    }
+    const std::vector<float>& mrphWeights() const noexcept { return mrphWs_ ? *mrphWs_ : empty<float>(); }
+    const std::vector<float>& cMrphWeights() const noexcept { return mrphWeights(); }
 
-    const std::vector<SubMorph>& subMrphs() const noexcept { return subMrphs_; }
+    const std::vector<SubMorph>& subMrphs() const noexcept { return subMrphs_ ? *subMrphs_ : empty<SubMorph>(); }
 
     const SubMorph* subMrph(uint32_t index) const noexcept {
-        return index < subMrphs_.size() ? &subMrphs_[index] : nullptr;
+        return index < subMrphs().size() ? &subMrphs()[index] : nullptr;
     }
 
 private:
     Asc::Handle meshHandle_;
     Asc::Handle skeleNodeHandle_;
+    bool static_ = false;
 
-    std::vector<float> mrphWs_; // Flat weights for morph targets
-    std::vector<SubMorph> subMrphs_; // Submesh morph target info
+    std::shared_ptr<std::vector<float>> mrphWs_; // Flat weights for morph targets
+    std::shared_ptr<const std::vector<SubMorph>> subMrphs_; // Submesh morph target info, never written after assignMesh
+
+    template<typename T>
+    static const std::vector<T>& empty() noexcept {
+        static const std::vector<T> none;
+        return none;
+    }
 };
 
 }
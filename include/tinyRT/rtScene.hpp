@@ -2,6 +2,7 @@
 
 
 #include "ascReg.hpp"
+#include "ascName.hpp"
 #include "tinyCamera.hpp"
 #include "tinyDrawable.hpp"
 
@@ -11,6 +12,8 @@
 #include "tinyRT/rtSkeleton.hpp"
 #include "tinyRT/rtScript.hpp"
 
+#include "tinyRT/rtBVH.hpp"
+
 namespace tinyRT {
 
 struct SceneRes {
@@ -30,69 +33,101 @@ struct SceneRes {
     template<typename T> const T* fsGet(Asc::Handle handle) const { return fsr->get<T>(handle); }
 };
 
+// Built-in component slots, a new component type needs a line here
+template<typename T> inline constexpr uint32_t compSlot = UINT32_MAX;
+template<> inline constexpr uint32_t compSlot<Transform3D>  = 0;
+template<> inline constexpr uint32_t compSlot<MeshRender3D> = 1;
+template<> inline constexpr uint32_t compSlot<Skeleton3D>   = 2;
+template<> inline constexpr uint32_t compSlot<Script>       = 3;
+
+/* Node
+
+No heap at all: interned name, intrusive child list, inline component handles
+Children are first-child/next-sibling in insertion order, walk them with Scene::nForEachChild
+*/
 struct Node {
-    // Empty ahh container 🥀🙏
-    Node() noexcept = default; // Make non-trivial
+    static constexpr uint32_t COMP_SLOTS = 4;
+
+    Node() noexcept = default;
 
-    std::string name;
-    const char* cname() const noexcept { return name.c_str(); }
+    Asc::Name::ID nameID = Asc::Name::EMPTY;
+    uint32_t nameSlot = 0; // Position in the scene's name index, Scene keeps it
+    const std::string& name() const noexcept { return Asc::Name::str(nameID); }
+    const char* cname() const noexcept { return name().c_str(); }
 
     Asc::Handle parent;
-    std::vector<Asc::Handle> children;
+    Asc::Handle firstChild;
+    Asc::Handle lastChild;
+    Asc::Handle prevSibling;
+    Asc::Handle nextSibling;
+    uint32_t childCount = 0;
 
-    // Entity data
-    std::map<Asc::Type::ID, Asc::Handle> comps;
+    // Entity data, bit compSlot<T> set = comps[compSlot<T>] is live
+    uint32_t compMask = 0;
+    Asc::Handle comps[COMP_SLOTS];
 
 // Some helpers
 
     size_t childrenCount() const noexcept {
-        return children.size();
-    }
-
-    int whereChild(Asc::Handle child) const noexcept {
-        for (size_t i = 0; i < children.size(); ++i) {
-            if (children[i] == child) return static_cast<int>(i);
-        }
-        return -1;
+        return childCount;
     }
 
-    int addChild(Asc::Handle child) noexcept {
-        int idx = whereChild(child);
-        if (idx != -1) return idx;
-        children.push_back(child);
-        return static_cast<int>(children.size() - 1);
-    }
-
-    bool rmChild(Asc::Handle child) noexcept {
-        int idx = whereChild(child);
-        if (idx == -1) return false;
-        children.erase(children.begin() + idx);
-        return true;
+    template<typename T>
+    static constexpr uint32_t slot() noexcept {
+        static_assert(compSlot<T> < COMP_SLOTS, "Not a scene component, give it a compSlot");
+        return compSlot<T>;
     }
 
     template<typename T>
     bool has() const noexcept {
-        return comps.find(Asc::Type::TypeID<T>()) != comps.end();
+        return compMask & (1u << slot<T>());
     }
 
     template<typename T>
     Asc::Handle get() const noexcept {
-        auto it = comps.find(Asc::Type::TypeID<T>());
-        return it != comps.end() ? it->second : Asc::Handle();
+        return has<T>() ? comps[slot<T>()] : Asc::Handle();
     }
 
     template<typename T>
     void erase() noexcept {
-        auto it = comps.find(Asc::Type::TypeID<T>());
-        if (it != comps.end()) comps.erase(it);
+        compMask &= ~(1u << slot<T>());
+        comps[slot<T>()].invalidate();
     }
 
     template<typename T>
     void add(Asc::Handle h) noexcept {
-        comps[Asc::Type::TypeID<T>()] = h;
+        compMask |= 1u << slot<T>();
+        comps[slot<T>()] = h;
+    }
+
+    template<typename F>
+    void forEachComp(F&& f) const {
+        for (uint32_t i = 0; i < COMP_SLOTS; ++i) {
+            if (compMask & (1u << i)) f(comps[i]);
+        }
     }
 };
 
+class Scene;
+
+/* Deferred scene edits
+
+Same shape as the node APIs, but nothing happens until Scene::flush()
+Safe to record from scripts in the middle of Scene::update() or from worker threads
+
+Returned handles are pending, only usable in other commands of the same flush
+*/
+class SceneCmds : public Asc::CmdQueue<Scene> {
+public:
+    Asc::Handle nAdd(const std::string& name = "New Node", Asc::Handle parent = Asc::Handle());
+    void nErase(Asc::Handle nHandle, bool recursive = true);
+    void nReparent(Asc::Handle nHandle, Asc::Handle nNewParent);
+
+    template<typename T> Asc::Handle nAddComp(Asc::Handle nHandle);
+    template<typename T> void nWriteComp(Asc::Handle nHandle, T data); // Add if missing, then overwrite
+    template<typename T> void nEraseComp(Asc::Handle nHandle);
+};
+
 class Scene {
 // Default stuff
     SceneRes res_;
@@ -101,10 +136,117 @@ class Scene {
     Asc::Pool<Node> nodes_;
     Asc::Handle root_;
 
+    bool clean_ = true; // Pools are in DFS order (see cleanse())
+
+    // Hierarchy flattened in DFS order, parents always before children. Rebuilt lazily on structural change
+    struct Flat {
+        std::vector<Asc::Handle> nodes;
+        std::vector<uint32_t>    parents; // index into nodes, UINT32_MAX = top
+        std::vector<uint32_t>    ends;    // one past the last entry of the subtree, subtrees are contiguous
+        std::vector<glm::mat4>   worlds;  // accumulated world per entry (parent's if no transform)
+        std::vector<uint32_t>    debugs;  // entries named "Debug" (spin test)
+        std::vector<uint32_t>    index;   // node handle index -> entry, UINT32_MAX = not in the tree
+    } flat_;
+    bool flatDirty_ = true;
+
+    // Transform pool is change-tracked, only subtrees under a stamped local get recomputed
+    // Anything the stamps can't see (rebuild, a transform going away) forces a full pass
+    bool worldsDirty_ = true;
+    uint32_t tranfmSeen_ = 0; // Transform pool tick of the last pass
+    std::vector<uint32_t> dirtyRoots_;
+    std::vector<uint32_t> movedRoots_; // dirtyRoots_ before splitting, what the bounds refit walks
+
+    // World bounds of every mesh node in the tree, refit right after the transform pass
+    // Mesh pool is change-tracked too, new meshes and mesh swaps (via nPatchComp) get picked up
+    BVH bvh_;
+    std::vector<uint32_t> bvhProxy_; // Node handle index -> proxy, BVH::NONE = none
+    uint32_t meshSeen_ = 0;          // Mesh pool tick of the last refit
+
+    void syncBounds(Asc::Handle nHandle, const rtMESHRD3D& meshRD3D, const glm::mat4& world);
+    void dropBounds(Asc::Handle nHandle) noexcept;
+
+    // Static meshes live in the drawable's retained list, synced at the same points as the bounds
+    // Their leaves are tagged so the frustum cull never walks them, the list culls its own groups
+    enum BoundsTag : uint32_t { BoundsDynamic = 1, BoundsRetained = 2 };
+
+    struct DrawItem {
+        Asc::Handle node;
+        Asc::Handle item;
+    };
+    tinyDrawable::List drawList_;
+    std::vector<DrawItem> drawItems_; // Node handle index -> list item
+
+    void syncDraw(Asc::Handle nHandle, const rtMESHRD3D& meshRD3D, const glm::mat4& world);
+    void dropDraw(Asc::Handle nHandle) noexcept;
+
+    // update() phases, in order. Everything but scripts fans out across cores
+    void updateWorlds() noexcept;
+    void updateWorlds(uint32_t begin, uint32_t end) noexcept;
+    void splitWorldRoots() noexcept; // More, smaller subtrees for the parallel pass
+    void updateBounds() noexcept;
+    void updateSkeletons() noexcept;
+    void updateScripts(float dt) noexcept;
+    void extractDraws() noexcept;
+
+    std::vector<uint32_t> visible_; // Mesh pool positions that survived the frustum, pool order
+
+    void dirtyHierarchy() noexcept { clean_ = false; flatDirty_ = true; touch(); }
+
+    // Flattened copy source for instantiate(), rebuilt lazily once this scene's shape changed
+    // Only shape lives here (links, names, who has what), component data is read live
+    struct Prefab {
+        static constexpr uint32_t NONE = UINT32_MAX;
+
+        struct Entry { // Links are entry indices, NONE = outside the prefab
+            Asc::Name::ID name;
+            uint32_t parent, firstChild, lastChild, prevSibling, nextSibling;
+            uint32_t childCount;
+        };
+        std::vector<Entry> nodes; // DFS order, [0] is the root
+
+        struct Comps { // Parallel arrays, per component slot
+            std::vector<uint32_t>    owners; // Entry index
+            std::vector<Asc::Handle> src;    // Component in the source scene
+        };
+        Comps comps[Node::COMP_SLOTS];
+
+        std::vector<Asc::Handle> srcNodes; // Entry -> source node
+        std::vector<uint32_t>    entryOf;  // Source node index -> entry, for handles stored in component data
+
+        [[nodiscard]] uint32_t entry(Asc::Handle h) const noexcept {
+            if (!h || h.index >= entryOf.size()) return NONE;
+            uint32_t i = entryOf[h.index];
+            return i != NONE && srcNodes[i] == h ? i : NONE;
+        }
+
+        uint64_t revision = UINT64_MAX;
+    };
+    mutable std::unique_ptr<Prefab> prefab_;
+    uint64_t revision_ = 0; // Bumped on anything a Prefab captures
+
+    void touch() noexcept { ++revision_; }
+    const Prefab& prefab() const noexcept;
+
+    // Name ID -> every node carrying it, kept in sync by add/rename/erase/instantiate
+    std::unordered_map<Asc::Name::ID, std::vector<Asc::Handle>> byName_;
+    void indexName(Asc::Handle nHandle) noexcept;
+    void unindexName(Asc::Handle nHandle) noexcept;
+
+    // Intrusive child list upkeep, no dirtying
+    void linkChild(Asc::Handle parent, Asc::Handle child) noexcept; // Append
+    void unlinkChild(Asc::Handle child) noexcept;
+    void rebuildFlat() noexcept;
+
+    std::unique_ptr<SceneCmds> cmds_ = std::make_unique<SceneCmds>(); // Boxed, queues don't move
+
 // Internal helpers
     [[nodiscard]] inline Asc::Reg& fsr() noexcept { return *res_.fsr; }
     [[nodiscard]] inline tinyCamera& camera() noexcept { return *res_.camera; }
 
+    // Batch-clone one component type for instantiate(), copy(dst, src) fills the data in
+    template<typename T, typename F>
+    void cloneComps(const Scene& from, const Prefab& pf, const std::vector<Asc::Handle>& toNodes, F&& copy) noexcept;
+
 public:
     Scene() noexcept = default;
     void init(const SceneRes& res) noexcept;
@@ -128,11 +270,25 @@ public:
     [[nodiscard]] SceneRes& res() noexcept { return res_; }
     [[nodiscard]] const SceneRes& res() const noexcept { return res_; }
 
+    [[nodiscard]] Asc::PoolStats nodeStats() const noexcept { return nodes_.stats(); }
+
     [[nodiscard]] tinyDrawable& drawable() noexcept { return *res_.drawable; }
     [[nodiscard]] const tinyDrawable& drawable() const noexcept { return *res_.drawable; }
 
 // Node APIs
-    std::string& nName(Asc::Handle nHandle) noexcept;
+    const std::string& nName(Asc::Handle nHandle) const noexcept;
+    void nRename(Asc::Handle nHandle, std::string name) noexcept;
+
+    // Name lookups, O(1). Which one nFind picks among same-named nodes is unspecified
+    [[nodiscard]] Asc::Handle nFind(Asc::Name::ID nameID) const noexcept;
+    [[nodiscard]] Asc::Handle nFind(std::string_view name) const noexcept { return nFind(Asc::Name::find(name)); }
+
+    // Valid until the next add/rename/erase
+    [[nodiscard]] Asc::Span<const Asc::Handle> nFindAll(Asc::Name::ID nameID) const noexcept;
+    [[nodiscard]] Asc::Span<const Asc::Handle> nFindAll(std::string_view name) const noexcept { return nFindAll(Asc::Name::find(name)); }
+
+    // Mesh world bounds, as of the last update()'s transform pass. Queries hand back node handles
+    [[nodiscard]] const BVH& bvh() const noexcept { return bvh_; }
 
     [[nodiscard]] Asc::Handle rootHandle() const noexcept { return root_; }
     bool rootShift() noexcept;
@@ -143,25 +299,44 @@ public:
     [[nodiscard]] Node* node(Asc::Handle nHandle) noexcept { return nodes_.get(nHandle); }
     [[nodiscard]] const Node* node(Asc::Handle nHandle) const noexcept { return nodes_.get(nHandle); }
 
-    [[nodiscard]] std::vector<Asc::Handle> nQueue(Asc::Handle start) noexcept;
+    [[nodiscard]] std::vector<Asc::Handle> nQueue(Asc::Handle start) const noexcept;
+    [[nodiscard]] std::vector<Asc::Handle> nChildren(Asc::Handle nHandle) const noexcept;
+
+    template<typename F>
+    void nForEachChild(Asc::Handle nHandle, F&& f) const {
+        const Node* node = nodes_.get(nHandle);
+        for (Asc::Handle c = node ? node->firstChild : Asc::Handle(); c;) {
+            Asc::Handle next = nodes_.get(c)->nextSibling; // f may unlink c
+            f(c);
+            c = next;
+        }
+    }
     Asc::Handle nAdd(const std::string& name = "New Node", Asc::Handle parent = Asc::Handle()) noexcept;
     void nErase(Asc::Handle nHandle, bool recursive = true, size_t* count = nullptr) noexcept;
     Asc::Handle nReparent(Asc::Handle nHandle, Asc::Handle nNewParent) noexcept;
 
+    // Components are owned by their node handle, lookup skips the node entirely
     template<typename T>
     T* nGetComp(Asc::Handle nHandle) noexcept {
-        const Node* node = nodes_.get(nHandle);
-        if (!node || !node->has<T>()) return nullptr;
-
-        return rt_.get<T>(node->get<T>());
+        return rt_.getFor<T>(nHandle);
     }
 
     template<typename T>
     const T* nGetComp(Asc::Handle nHandle) const noexcept {
-        const Node* node = nodes_.get(nHandle);
-        if (!node || !node->has<T>()) return nullptr;
+        return rt_.getFor<T>(nHandle);
+    }
+
+    // nGetComp that also stamps the component as changed this tick (tracked pools only)
+    // Writes to a Transform3D must come through here, otherwise the world won't follow
+    template<typename T>
+    T* nPatchComp(Asc::Handle nHandle) noexcept {
+        return rt_.writeFor<T>(nHandle);
+    }
 
-        return rt_.get<T>(node->get<T>());
+    // All nodes having every listed component, eg. view<rtTRANFM3D, rtMESHRD3D>().forEach(...)
+    template<typename A, typename B, typename... Rest>
+    [[nodiscard]] Asc::View<A, B, Rest...> view() noexcept {
+        return rt_.view<A, B, Rest...>();
     }
 
     template<typename T>
@@ -169,8 +344,10 @@ public:
         Node* node = nodes_.get(nHandle);
         if (!node || node->has<T>()) return Asc::Handle();
 
-        Asc::Handle compHandle = rt_.emplace<T>();
+        Asc::Handle compHandle = rt_.emplaceFor<T>(nHandle);
         node->add<T>(compHandle);
+        clean_ = false;
+        touch();
 
         return compHandle;
     }
@@ -186,20 +363,37 @@ public:
         Node* node = nodes_.get(nHandle);
         if (!node || !node->has<T>()) return;
 
+        if constexpr (std::is_same_v<T, MeshRender3D>) { dropBounds(nHandle); dropDraw(nHandle); }
+
         rt_.erase(node->get<T>());
         node->erase<T>();
+        clean_ = false;
+        touch();
+
+        // Children were relying on this local, no stamp left to tell them
+        if constexpr (std::is_same_v<T, Transform3D>) worldsDirty_ = true;
     }
 
     void nEraseAllComps(Asc::Handle nHandle) noexcept;
 
+// Deferred edits
+    [[nodiscard]] SceneCmds& cmds() noexcept { return *cmds_; }
+    size_t flush() noexcept; // Apply everything recorded in cmds(), returns command count
+
 // Special scene methods
-    void cleanse() noexcept {} // Rewire pool into clean DFS order (to be implemented)
+    void cleanse() noexcept; // Rewire node and component pools into DFS order, handles stay valid
+    [[nodiscard]] bool isClean() const noexcept { return clean_; }
 
 // Scene stuff and things idk
     void update(FrameStart frameStart) noexcept;
 
     Asc::Handle instantiate(Asc::Handle sceneHandle, Asc::Handle parent = Asc::Handle()) noexcept;
 
+    // Binary snapshot, see rtSnapshot.hpp. load() adds the saved tree under parent like instantiate(),
+    // returns its root (empty handle if the file is missing or malformed)
+    bool save(const std::string& path) const;
+    Asc::Handle load(const std::string& path, Asc::Handle parent = Asc::Handle());
+
 
 // Testing ground
 
@@ -210,6 +404,34 @@ public:
     std::vector<TestRender> testRenders;
 };
 
+// SceneCmds templates (need the full Scene)
+
+template<typename T>
+Asc::Handle SceneCmds::nAddComp(Asc::Handle nHandle) {
+    Asc::Handle p = pending();
+    push([p, nHandle](Scene& scene, Asc::CmdQueue<Scene>& q) {
+        q.bind(p, scene.nAddComp<T>(q.resolve(nHandle)));
+    });
+    return p;
+}
+
+template<typename T>
+void SceneCmds::nWriteComp(Asc::Handle nHandle, T data) {
+    auto box = std::make_shared<T>(std::move(data));
+    push([nHandle, box](Scene& scene, Asc::CmdQueue<Scene>& q) {
+        Asc::Handle h = q.resolve(nHandle);
+        scene.nAddComp<T>(h);
+        if (T* comp = scene.nPatchComp<T>(h)) *comp = std::move(*box); // Stamped, the world and draws follow
+    });
+}
+
+template<typename T>
+void SceneCmds::nEraseComp(Asc::Handle nHandle) {
+    push([nHandle](Scene& scene, Asc::CmdQueue<Scene>& q) {
+        scene.nEraseComp<T>(q.resolve(nHandle));
+    });
+}
+
 } // namespace tinyRT
 
 using rtNode = tinyRT::Node;
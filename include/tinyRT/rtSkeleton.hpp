@@ -3,24 +3,39 @@
 #include "tinySkeleton.hpp"
 #include "ascPool.hpp"
 
+#include <memory>
+
 namespace tinyRT {
 
+/* Skeleton3D
+
+Pose arrays (local/final/skin) sit behind a shared pointer. copy() shares them, the first
+write through localPose()/refresh() detaches a private copy. Instances that never move
+a bone all read the source's arrays, and update() skips them since nothing is dirty
+*/
+
 struct Skeleton3D {
     void init(const Asc::Pool<tinySkeleton>* pool, Asc::Handle handle) {
         pool_ = pool;
         handle_ = handle;
+        pose_.reset();
 
         const tinySkeleton* skeleton = rSkeleton();
         if (!skeleton) return;
 
-        localPose_.resize(skeleton->bones.size(), glm::mat4(1.0f));
-        finalPose_.resize(skeleton->bones.size(), glm::mat4(1.0f));
-        skinData_.resize(skeleton->bones.size(), glm::mat4(1.0f));
+        Pose& pose = writePose();
+        pose.local.resize(skeleton->bones.size(), glm::mat4(1.0f));
+        pose.final.resize(skeleton->bones.size(), glm::mat4(1.0f));
+        pose.skin.resize(skeleton->bones.size(), glm::mat4(1.0f));
 
         // Initialize local pose to bind pose
         for (size_t i = 0; i < skeleton->bones.size(); ++i) {
-            localPose_[i] = skeleton->bones[i].bindPose;
+            pose.local[i] = skeleton->bones[i].bindPose;
         }
+
+        // Settle the palette now, copies of a clean skeleton can share it as-is
+        dirty_ = true;
+        update();
     }
 
     void copy(const Skeleton3D* other) {
@@ -29,25 +44,29 @@ struct Skeleton3D {
         pool_ = other->pool_;
         handle_ = other->handle_;
 
-        localPose_ = other->localPose_;
-        finalPose_ = other->finalPose_;
-        skinData_ = other->skinData_;
+        pose_ = other->pose_;
+        dirty_ = other->dirty_;
     }
 
     void update(uint32_t boneIdx = 0) noexcept {
+        // Nothing moved since the last palette, shared or not it's still valid
+        if (!dirty_) return;
+
         // If boneIdx is 0, traverse linearly
         const tinySkeleton* skeleton = rSkeleton();
         if (!skeleton || boneIdx >= skeleton->bones.size()) return;
 
+        Pose& pose = writePose();
+
         if (boneIdx == 0) {
             // Linear update
             for (size_t i = 0; i < skeleton->bones.size(); ++i) {
                 const tinyBone& bone = skeleton->bones[i];
 
-                glm::mat4 parentTransform = (bone.parent != -1) ? finalPose_[bone.parent] : glm::mat4(1.0f);
+                glm::mat4 parentTransform = (bone.parent != -1) ? pose.final[bone.parent] : glm::mat4(1.0f);
 
-                finalPose_[i] = parentTransform * localPose_[i];
-                skinData_[i] = finalPose_[i] * bone.bindInverse;
+                pose.final[i] = parentTransform * pose.local[i];
+                pose.skin[i] = pose.final[i] * bone.bindInverse;
             }
         } else {
             std::function<void(uint32_t, const glm::mat4&)> recursiveUpdate =
@@ -56,22 +75,25 @@ struct Skeleton3D {
 
                 const tinyBone& bone = skeleton->bones[index];
 
-                finalPose_[index] = parentTransform * localPose_[index];
-                skinData_[index] = finalPose_[index] * bone.bindInverse;
+                pose.final[index] = parentTransform * pose.local[index];
+                pose.skin[index] = pose.final[index] * bone.bindInverse;
 
                 for (int childIndex : bone.children) {
-                    recursiveUpdate(childIndex, finalPose_[index]);
+                    recursiveUpdate(childIndex, pose.final[index]);
                 }
             };
 
             // Retrieve parent
             glm::mat4 parentTransform = glm::mat4(1.0f);
             if (skeleton->bones[boneIdx].parent != -1) {
-                parentTransform = finalPose_[skeleton->bones[boneIdx].parent];
+                parentTransform = pose.final[skeleton->bones[boneIdx].parent];
             }
 
             recursiveUpdate(boneIdx, parentTransform);
+            return; // Partial, other branches may still be stale
         }
+
+        dirty_ = false;
     }
 
     inline const tinySkeleton* rSkeleton() const noexcept {
@@ -82,23 +104,32 @@ struct Skeleton3D {
         return handle_;
     }
 
-    glm::mat4& localPose(uint32_t boneIndex) noexcept { return localPose_.at(boneIndex); }
+    // Writable, detaches a shared pose. Read through cLocalPose() to keep sharing
+    glm::mat4& localPose(uint32_t boneIndex) {
+        dirty_ = true;
+        return writePose().local.at(boneIndex);
+    }
+    const glm::mat4& cLocalPose(uint32_t boneIndex) const { return readPose().local.at(boneIndex); }
+    const std::vector<glm::mat4>& localPoses() const noexcept { return readPose().local; }
 
-    inline const std::vector<glm::mat4>& skinData() const noexcept { return skinData_; }
+    inline const std::vector<glm::mat4>& skinData() const noexcept { return readPose().skin; }
 
     void refresh(uint32_t boneIndex, bool recursive = false) {
         // Reset the local pose to the bind pose
         const tinySkeleton* skeleton = rSkeleton();
         if (!skeleton || boneIndex >= skeleton->bones.size()) return;
 
-        localPose_[boneIndex] = skeleton->bones[boneIndex].bindPose;
+        std::vector<glm::mat4>& localPose = writePose().local;
+        dirty_ = true;
+
+        localPose[boneIndex] = skeleton->bones[boneIndex].bindPose;
 
         if (!recursive) return;
 
         std::function<void(uint32_t)> refreshRec = [&](uint32_t index) {
             if (index >= skeleton->bones.size()) return;
 
-            localPose_[index] = skeleton->bones[index].bindPose;
+            localPose[index] = skeleton->bones[index].bindPose;
 
             for (int childIndex : skeleton->bones[index].children) {
                 refreshRec(childIndex);
@@ -111,9 +142,24 @@ private:
     const Asc::Pool<tinySkeleton>* pool_ = nullptr;
     Asc::Handle handle_;
 
-    std::vector<glm::mat4> localPose_;
-    std::vector<glm::mat4> finalPose_;
-    std::vector<glm::mat4> skinData_;
+    struct Pose {
+        std::vector<glm::mat4> local;
+        std::vector<glm::mat4> final;
+        std::vector<glm::mat4> skin;
+    };
+    std::shared_ptr<Pose> pose_; // Shared between copies until someone writes
+    bool dirty_ = false;         // Local pose changed since the last full update()
+
+    const Pose& readPose() const noexcept {
+        static const Pose empty;
+        return pose_ ? *pose_ : empty;
+    }
+
+    Pose& writePose() {
+        if (!pose_) pose_ = std::make_shared<Pose>();
+        else if (pose_.use_count() > 1) pose_ = std::make_shared<Pose>(*pose_);
+        return *pose_;
+    }
 };
 
 };
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tinyRT {
+
+/* Scene snapshot
+
+A whole scene as one flat little-endian blob. Every section is an array of fixed-size
+records at an 8-byte aligned offset, listed in the header:
+
+    Header | Node[] | Name[] | chars | Ref[] | Tranfm[] | Mesh[] | Skele[] | Script[] | floats | mat4s | vars
+
+Records link to each other by index (node entry, name, ref), never by pointer, so a mapped
+file is used as-is: Scene::load() walks the arrays in place and only turns indices into
+handles. Nodes are in DFS order, [0] is the saved root, so a parent always comes first and
+any file that passes that check is a tree
+
+Resources are referenced by content hash (tinyMesh/tinySkeleton/tinyScript/tinyTexture::hash())
+and resolved against whatever the registry holds at load time. No match = empty handle
+
+Poses and morph weights are only written when they differ from the resource's defaults,
+untouched components load shared (see Skeleton3D/MeshRender3D copy-on-write)
+*/
+
+namespace Snapshot {
+
+constexpr uint32_t MAGIC   = 0x4E435341; // "ASCN"
+constexpr uint32_t VERSION = 2; // 2: Mesh flags
+constexpr uint32_t NONE    = UINT32_MAX;
+
+enum Sec : uint32_t {
+    SecNodes, SecNames, SecChars, SecRefs,
+    SecTranfms, SecMeshes, SecSkeles, SecScripts,
+    SecFloats, SecMats, SecVars,
+    SecCount
+};
+
+struct Section {
+    uint64_t offset = 0; // Bytes from the start of the file
+    uint64_t count  = 0; // Records, not bytes
+};
+
+struct Header {
+    uint32_t magic   = MAGIC;
+    uint32_t version = VERSION;
+    uint64_t size    = 0; // Whole file, a truncated copy fails the check
+    Section  secs[SecCount];
+};
+
+struct Node { // Child lists are rebuilt from parents, siblings keep entry order
+    uint32_t name;
+    uint32_t parent; // Entry index, always before this one. NONE for the root only
+};
+
+struct Name {
+    uint32_t offset, length; // Into chars
+};
+
+enum class RefType : uint32_t { Mesh, Skeleton, Script, Texture };
+
+struct Ref {
+    uint64_t hash;
+    RefType  type;
+    uint32_t pad = 0;
+};
+
+struct Tranfm {
+    uint32_t node;
+    float pos[3];
+    float rot[4]; // x y z w
+    float scl[3];
+};
+
+enum MeshFlags : uint32_t { MeshStatic = 1 << 0 };
+
+struct Mesh {
+    uint32_t node, ref;
+    uint32_t skeleNode;            // Entry index
+    uint32_t weights, weightCount; // Into floats, 0 = mesh defaults
+    uint32_t flags;                // MeshFlags
+};
+
+struct Skele {
+    uint32_t node, ref;
+    uint32_t pose, poseCount; // Local pose, into mat4s, 0 = bind pose
+};
+
+struct Script {
+    uint32_t node, ref;
+    uint32_t vars, varsSize; // Byte range into vars
+};
+
+struct Mat4 { float m[16]; };
+
+}
+
+}
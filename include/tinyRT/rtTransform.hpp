@@ -4,16 +4,108 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <cmath>
+
 namespace tinyRT {
 
+/* Transform3D
+
+Translation/rotation/scale are the source of truth, local() is composed on demand
+and cached until the next setter. No decompose/compose round trip, no drift from
+scripts poking the same transform every frame
+
+Setters don't notify anyone, go through Scene::nPatchComp so the world follows
+*/
+
 struct Transform3D {
-    glm::mat4 local{1.0f};
     glm::mat4 world{1.0f};
 
-    // In the future will have more advanced dirty flag system
+    [[nodiscard]] const glm::vec3& pos() const noexcept { return pos_; }
+    [[nodiscard]] const glm::quat& rot() const noexcept { return rot_; }
+    [[nodiscard]] const glm::vec3& scl() const noexcept { return scl_; }
+
+    Transform3D& setPos(const glm::vec3& pos) noexcept {
+        pos_ = pos;
+        dirty_ = true;
+        return *this;
+    }
+
+    Transform3D& setRot(const glm::quat& rot) noexcept {
+        // Zero (or NaN) quaternion has no rotation to normalize, keep the current one
+        float len2 = glm::dot(rot, rot);
+        if (!(len2 > 1e-12f) || !std::isfinite(len2)) return *this;
+
+        rot_ = rot * (1.0f / std::sqrt(len2));
+        dirty_ = true;
+        return *this;
+    }
+
+    Transform3D& setScl(const glm::vec3& scl) noexcept {
+        // Scale restriction: cannot have 0 scale on any axis
+        for (int a = 0; a < 3; ++a) {
+            scl_[a] = glm::abs(scl[a]) < 1e-6f ? (scl[a] < 0.0f ? -1e-6f : 1e-6f) : scl[a];
+        }
+        dirty_ = true;
+        return *this;
+    }
+
+    Transform3D& rotate(const glm::quat& delta) noexcept { // Applied on top, in parent space
+        return setRot(delta * rot_);
+    }
+
+    // One-off decompose for matrix sources (model import, animation), assumes no shear
+    Transform3D& set(const glm::mat4& m) noexcept {
+        glm::vec3 cols[3] = { glm::vec3(m[0]), glm::vec3(m[1]), glm::vec3(m[2]) };
+        glm::vec3 scl(glm::length(cols[0]), glm::length(cols[1]), glm::length(cols[2]));
+
+        // Mirrored basis, fold the flip into x so the rest is a proper rotation
+        if (glm::dot(glm::cross(cols[0], cols[1]), cols[2]) < 0.0f) scl.x = -scl.x;
+
+        glm::mat3 basis(1.0f);
+        for (int a = 0; a < 3; ++a) {
+            if (glm::abs(scl[a]) > 1e-6f) basis[a] = cols[a] / scl[a];
+        }
+
+        pos_ = glm::vec3(m[3]);
+        rot_ = glm::normalize(glm::quat_cast(basis));
+        setScl(scl);
+        return *this;
+    }
+
+    // Values read back from another transform (snapshots), already normalized/clamped, taken bit-exact
+    Transform3D& restore(const glm::vec3& pos, const glm::quat& rot, const glm::vec3& scl) noexcept {
+        pos_ = pos;
+        rot_ = rot;
+        scl_ = scl;
+        dirty_ = true;
+        return *this;
+    }
+
+    [[nodiscard]] const glm::mat4& local() const noexcept {
+        if (dirty_) {
+            // T * R * S without the three full matrix products
+            glm::mat3 r = glm::mat3_cast(rot_);
+            local_ = glm::mat4(
+                glm::vec4(r[0] * scl_.x, 0.0f),
+                glm::vec4(r[1] * scl_.y, 0.0f),
+                glm::vec4(r[2] * scl_.z, 0.0f),
+                glm::vec4(pos_, 1.0f)
+            );
+            dirty_ = false;
+        }
+        return local_;
+    }
+
+private:
+    glm::vec3 pos_{0.0f};
+    glm::quat rot_{1.0f, 0.0f, 0.0f, 0.0f};
+    glm::vec3 scl_{1.0f};
+
+    mutable glm::mat4 local_{1.0f}; // Cache, only touched by local()
+    mutable bool dirty_ = false;
 };
 
 }
 
 using rtTransform3D = tinyRT::Transform3D;
-using rtTRANFM3D = tinyRT::Transform3D;
\ No newline at end of file
+using rtTRANFM3D = tinyRT::Transform3D;
@@ -23,6 +23,8 @@ struct tinyScript {
     // Get internal Lua state for advanced operations (use with caution!)
     lua_State* luaState() const { return luaInstance_.state(); }
 
+    uint64_t hash() const noexcept { return Asc::hashBytes(code.data(), code.size()); } // Source content hash
+
     bool valid() const { return compiled_ && luaInstance_.valid(); }
     uint32_t version() const { return version_; }
 
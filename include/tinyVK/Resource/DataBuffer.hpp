@@ -39,6 +39,7 @@ public:
     VkDeviceSize getDataSize() const { return dataSize_; }
     VkBufferUsageFlags getUsageFlags() const { return usageFlags_; }
     VkMemoryPropertyFlags getMemPropFlags() const { return memPropFlags_; }
+    void* getMapped() const { return mapped_; } // Null unless mapped, persistently mapped buffers can be written in place
 
 
     DataBuffer& setDataSize(VkDeviceSize size);
@@ -79,6 +79,27 @@ function generateRandomPosition(chaserPos, currentY)
     }
 end
 
+-- Is this node the chaser or somewhere under it (meshes usually sit on child nodes)
+function isChaserPart(node)
+    while node do
+        if node:handle() == VARS.chaserNode then
+            return true
+        end
+        node = node:parent()
+    end
+    return false
+end
+
+-- Any of the chaser's meshes within collisionRadius, bounds tested by the scene BVH
+function touchesChaser(myPos)
+    for _, node in ipairs(SCENE:queryRadius(myPos, VARS.collisionRadius)) do
+        if isChaserPart(node) then
+            return true
+        end
+    end
+    return false
+end
+
 function update()
     VARS.currentTime = VARS.currentTime + DELTATIME
     
@@ -108,12 +129,10 @@ function update()
     end
     
     local chaserPos = chaserT3d:getPos()
-    
-    -- Calculate distance between nodes
     local dist = distance3D(myPos, chaserPos)
-    
-    -- Check for collision
-    if dist <= VARS.collisionRadius then
+
+    -- Ask the scene BVH what's around us instead of measuring every candidate ourselves
+    if touchesChaser(myPos) then
         -- Collision detected! Teleport to random position
         VARS.totalCollisions = VARS.totalCollisions + 1
         VARS.lastCollisionTime = VARS.currentTime
@@ -122,7 +141,7 @@ function update()
         local newPos = generateRandomPosition(chaserPos, myPos.y)
         
         -- Teleport!
-        myT3d:setPos(newPos)
+        myT3d:setPos(Vec3(newPos.x, newPos.y, newPos.z))
         
         if VARS.showDebugInfo then
             print(string.format("TELEPORT! Collision #%d - Distance: %.2f - New pos: (%.1f, %.1f, %.1f)", 
@@ -248,6 +248,14 @@ void Renderer::drawTest(const tinyProject* project, const rtScene* scene, const
     VkDescriptorSet mrphWsSet = draw.mrphWsDescSet(); // Set 5
     uint32_t mrphWsOffset = draw.mrphWsOffset(currentFrame);
 
+    VkDescriptorSet drawSet = draw.drawDescSet(); // Set 6
+    uint32_t drawDataOffset = draw.drawDataOffset(currentFrame);
+
+    // Commands and DrawData were written by finalize, a mesh group is one indirect call
+    VkBuffer drawBuffer = draw.drawBuffer();
+    VkDeviceSize drawOffset = draw.drawOffset(currentFrame);
+    constexpr uint32_t drawStride = sizeof(VkDrawIndexedIndirectCommand);
+
     const auto& shaderGroups  = draw.shaderGroups();
     const auto& meshGroups    = draw.meshGroups();
     const auto& submeshGroups = draw.submeshGroups();
@@ -267,6 +275,7 @@ void Renderer::drawTest(const tinyProject* project, const rtScene* scene, const
         pipeline->bindSets(currentCmd, 3, &texSet, 1, nullptr, 0);
         pipeline->bindSets(currentCmd, 4, &skinSet, 1, &skinOffset, 1);
         pipeline->bindSets(currentCmd, 5, &mrphWsSet, 1, &mrphWsOffset, 1);
+        pipeline->bindSets(currentCmd, 6, &drawSet, 1, &drawDataOffset, 1);
 
         // Bind instances once
         VkBuffer instaBuffers[] = { draw.instaBuffer() };
@@ -275,6 +284,7 @@ void Renderer::drawTest(const tinyProject* project, const rtScene* scene, const
 
         for (const auto& meshGroupIdx : shaderGroup.meshGroupIndices) {
             const auto& meshGroup = meshGroups[meshGroupIdx];
+            if (!meshGroup.drawCount) continue; // Ran out of draws
 
             const auto* rMesh = sharedRes.fsGet<tinyMesh>(meshGroup.mesh);
             if (!rMesh) continue; // Should not happen
@@ -293,30 +303,24 @@ void Renderer::drawTest(const tinyProject* project, const rtScene* scene, const
             vrtxExtSet = (vrtxExtSet != VK_NULL_HANDLE) ? vrtxExtSet : dummy.mesh.vrtxExtSet();
             pipeline->bindSets(currentCmd, 1, &vrtxExtSet, 1, nullptr, 0);
 
-            for (const auto& submeshGroupIdx : meshGroup.submeshGroupIndices) {
-                const auto& submeshGroup = submeshGroups[submeshGroupIdx];
+            if (dvk->multiDrawIndirect) {
+                // Shader reads draws[drawBase + gl_DrawID]
+                VkDeviceSize cmdOffset = drawOffset + VkDeviceSize(meshGroup.drawOffset) * drawStride;
+                pipeline->pushConstants(currentCmd, ShaderStage::Vertex, 0, meshGroup.drawOffset);
+                vkCmdDrawIndexedIndirect(currentCmd, drawBuffer, cmdOffset, meshGroup.drawCount, drawStride);
+                continue;
+            }
+
+            // No multi draw (or no firstInstance in indirect commands): direct draws, gl_DrawID stays 0
+            for (uint32_t i = 0; i < meshGroup.drawCount; ++i) {
+                const auto& submeshGroup = submeshGroups[meshGroup.submeshGroupIndices[i]];
 
                 const auto* submesh = rMesh->submesh(submeshGroup.submesh);
                 if (!submesh) continue; // Should not happen hopefully
 
-                pipeline->pushConstants(currentCmd, ShaderStage::VertexAndFragment, 0,
-                    glm::uvec4(
-                        submesh->vrtxFlags(), submesh->vrtxCount,
-                        submesh->mrphTargetCount, draw.matIndex(submesh->material)
-                    )
-                );
-                pipeline->pushConstants(currentCmd, ShaderStage::VertexAndFragment, sizeof(glm::uvec4),
-                    glm::uvec4(
-                        submesh->vstaticOffset, submesh->vriggedOffset,
-                        submesh->vcolorOffset,  submesh->vmrphsOffset
-                    )
-                );
-                pipeline->pushConstants(currentCmd, ShaderStage::VertexAndFragment, 2 * sizeof(glm::uvec4),
-                    glm::uvec4(submesh->mrphTargetCount, 0, 0, 0)
-                );
-
+                pipeline->pushConstants(currentCmd, ShaderStage::Vertex, 0, meshGroup.drawOffset + i);
                 vkCmdDrawIndexed(
-                    currentCmd, 
+                    currentCmd,
                     submesh->indxCount,
                     submeshGroup.instaCount,
                     submesh->indxOffset,
@@ -54,6 +54,20 @@ void Device::pickPhysicalDevice(VkInstance instance, VkSurfaceKHR surface) {
     throw std::runtime_error("No suitable Vulkan GPU found.");
 }
 
+// Vulkan 1.1 feature support, chain-free copy
+static VkPhysicalDeviceVulkan11Features queryVk11Features(VkPhysicalDevice device) {
+    VkPhysicalDeviceVulkan11Features vk11Features{};
+    vk11Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+
+    VkPhysicalDeviceFeatures2 features2{};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features2.pNext = &vk11Features;
+    vkGetPhysicalDeviceFeatures2(device, &features2);
+
+    vk11Features.pNext = nullptr;
+    return vk11Features;
+}
+
 // ---------------- LOGICAL DEVICE ----------------
 void Device::createLogicalDevice() {
     std::set<uint32_t> uniqueFamilies = {
@@ -80,6 +94,17 @@ void Device::createLogicalDevice() {
     deviceFeatures.samplerAnisotropy = VK_TRUE;
     deviceFeatures.sampleRateShading = VK_TRUE;
 
+    // Indirect draws, only where supported, the renderer falls back to direct draws
+    deviceFeatures.multiDrawIndirect = pFeatures.multiDrawIndirect;
+    deviceFeatures.drawIndirectFirstInstance = pFeatures.drawIndirectFirstInstance;
+    multiDrawIndirect = pFeatures.multiDrawIndirect && pFeatures.drawIndirectFirstInstance;
+
+    // Only what's needed, supported or the device wouldn't have been picked
+    VkPhysicalDeviceVulkan11Features vk11Supported = queryVk11Features(pDevice);
+    VkPhysicalDeviceVulkan11Features vk11Features{};
+    vk11Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+    vk11Features.shaderDrawParameters = vk11Supported.shaderDrawParameters; // gl_DrawID
+
     VkPhysicalDeviceVulkan12Features vk12Features{};
     vk12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
     vk12Features.descriptorIndexing = VK_TRUE;
@@ -89,6 +114,7 @@ void Device::createLogicalDevice() {
     vk12Features.shaderStorageImageArrayNonUniformIndexing = VK_TRUE;
     vk12Features.descriptorBindingVariableDescriptorCount = VK_TRUE;  // if you use runtime arrays
     vk12Features.descriptorBindingPartiallyBound = VK_TRUE;           // optional
+    vk12Features.pNext = &vk11Features;
 
     VkDeviceCreateInfo ci{};
     ci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -153,7 +179,10 @@ bool Device::isDeviceSuitable(VkPhysicalDevice device, VkSurfaceKHR surface) {
         vkGetPhysicalDeviceSurfacePresentModesKHR(device, surface, &presentCount, nullptr);
     }
 
-    return indices.isComplete() && extensionsOk && fmtCount > 0 && presentCount > 0;
+    // Draw shaders index their per draw data with gl_DrawID
+    bool drawParamsOk = queryVk11Features(device).shaderDrawParameters == VK_TRUE;
+
+    return indices.isComplete() && extensionsOk && fmtCount > 0 && presentCount > 0 && drawParamsOk;
 }
 
 bool Device::checkDeviceExtensionSupport(VkPhysicalDevice device) {
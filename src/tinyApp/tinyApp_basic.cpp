@@ -82,10 +82,11 @@ void tinyApp::initComponents() {
         project->drawable().matDescLayout(),   // Set 2
         project->drawable().texDescLayout(),   // Set 3
         project->drawable().skinDescLayout(),  // Set 4
-        project->drawable().mrphWsDescLayout() // Set 5
+        project->drawable().mrphWsDescLayout(), // Set 5
+        project->drawable().drawDescLayout()    // Set 6
     };
     testCfg.pushConstantRanges = {
-        { ShaderStage::VertexAndFragment, 0, 48 } // 3 x uvec4
+        { ShaderStage::Vertex, 0, sizeof(uint32_t) } // drawBase, the rest is per draw in set 6
     };
     testCfg.attributes = tinyDrawable::attributeDescs();
     testCfg.bindings = tinyDrawable::bindingDesc();
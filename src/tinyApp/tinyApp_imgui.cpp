@@ -1004,7 +1004,7 @@ static Editor::Tab CreateRtSkeletonEditorTab(const std::string& title, Asc::Hand
             ImGui::Text("Bone: %d - %s", *selectedBoneIndex, selectedBone.name.c_str());
             ImGui::Separator();
             
-            glm::mat4& boneLocal = skel3D->localPose(*selectedBoneIndex);
+            const glm::mat4& boneLocal = skel3D->cLocalPose(*selectedBoneIndex); // Writes go through recompose()
             
             glm::vec3 translation, scale, skew;
             glm::quat rotation;
@@ -1016,7 +1016,7 @@ static Editor::Tab CreateRtSkeletonEditorTab(const std::string& title, Asc::Hand
                 glm::mat4 t = glm::translate(glm::mat4(1.0f), translation);
                 glm::mat4 r = glm::mat4_cast(rotation);
                 glm::mat4 s = glm::scale(glm::mat4(1.0f), scale);
-                boneLocal = t * r * s;
+                skel3D->localPose(*selectedBoneIndex) = t * r * s;
             };
             
             glm::quat* initialRotation = self.getState<glm::quat>("initialRotation");
@@ -1102,7 +1102,7 @@ static Editor::Tab CreateRtMorphTargetEditorTab(const std::string& title, Asc::H
         }
         
         ImGui::Separator();
-        ImGui::Text("Morph Count: %zu", meshRD->mrphWeights().size());
+        ImGui::Text("Morph Count: %zu", meshRD->cMrphWeights().size());
     };
     
     // Define hover tooltip
@@ -1123,7 +1123,7 @@ static Editor::Tab CreateRtMorphTargetEditorTab(const std::string& title, Asc::H
         ImGui::Text("Morph Target Editor");
         ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Node: [%u, %u]", nHandle.idx(), nHandle.ver());
         ImGui::Separator();
-        ImGui::Text("Targets: %zu", meshRD->mrphWeights().size());
+        ImGui::Text("Targets: %zu", meshRD->cMrphWeights().size());
         ImGui::EndTooltip();
     };
     
@@ -1762,7 +1762,7 @@ static void RenderSceneNodeHierarchy() {
                 return;
             }
 
-            std::string name = node->name;
+            std::string name = node->name();
 
             bool hasChildren = node->childrenCount() > 0;
             bool isExpanded = State::isExpanded(h) && hasChildren;
@@ -1783,7 +1783,7 @@ static void RenderSceneNodeHierarchy() {
             if (State::renamed == h) {
                 bool enter = ImGui::InputText("##rename", State::renameBuffer, sizeof(State::renameBuffer), ImGuiInputTextFlags_EnterReturnsTrue);
                 if (enter || ImGui::IsItemDeactivatedAfterEdit()) {
-                    node->name = std::string(State::renameBuffer);
+                    scene->nRename(h, State::renameBuffer);
                     State::renamed = Asc::Handle();
                 }
             } else {
@@ -1811,7 +1811,7 @@ static void RenderSceneNodeHierarchy() {
             const rtNode* node = sceneRef->node(h);
             if (!node) return {};
 
-            std::vector<Asc::Handle> children = node->children;
+            std::vector<Asc::Handle> children = sceneRef->nChildren(h);
             std::sort(children.begin(), children.end(), [](Asc::Handle a, Asc::Handle b) {
                 const rtNode* nodeA = sceneRef->node(a);
                 const rtNode* nodeB = sceneRef->node(b);
@@ -1819,7 +1819,7 @@ static void RenderSceneNodeHierarchy() {
                 bool aHasChildren = nodeA && nodeA->childrenCount() > 0;
                 bool bHasChildren = nodeB && nodeB->childrenCount() > 0;
                 if (aHasChildren != bHasChildren) return aHasChildren > bHasChildren;
-                return nodeA->name < nodeB->name;
+                return nodeA->name() < nodeB->name();
             });
             return children;
         },
@@ -1853,7 +1853,7 @@ static void RenderSceneNodeHierarchy() {
             bool canDelete = h != sceneRef->rootHandle();
             if (ImGui::MenuItem("Erase", nullptr, false, canDelete)) sceneRef->nErase(h);
             
-            std::vector<Asc::Handle> children = node->children;
+            std::vector<Asc::Handle> children = sceneRef->nChildren(h);
             if (ImGui::MenuItem("Clear", nullptr, false, !children.empty())) {
                 for (const auto& child : children) sceneRef->nErase(child);
             }
@@ -1894,7 +1894,7 @@ static void RenderSceneNodeHierarchy() {
             const rtNode* node = scene->node(h);
             if (!node) return;
 
-            Payload payload = Payload::make(h, node->name);
+            Payload payload = Payload::make(h, node->name());
             ImGui::SetDragDropPayload("PAYLOAD", &payload, sizeof(payload));
             ImGui::Text("Dragging: %s", payload.name);
         },
@@ -2063,9 +2063,9 @@ static void RenderFileNodeHierarchy() {
                 if (RenderMenuItemToggle("Make Active", "Active", State::isActiveScene(dHandle))) {
                     State::sceneHandle = dHandle;
                 }
-                // if (RenderMenuItemToggle("Cleanse", "Cleansed", scene->isClean())) {
-                //     scene->cleanse();
-                // }
+                if (RenderMenuItemToggle("Cleanse", "Cleansed", scene->isClean())) {
+                    scene->cleanse();
+                }
             }
             if (dHandle.is<tinyScript>()) {
                 tinyScript* script = fs.rGet<tinyScript>(dHandle);
@@ -2178,11 +2178,10 @@ static void RenderTRANFM3D(const Asc::FS& fs, rtScene* scene, Asc::Handle nHandl
     rtTRANFM3D* trfm3D = scene->nGetComp<rtTRANFM3D>(nHandle);
     if (!trfm3D) return;
 
-    // Decompose local transform
-    glm::vec3 pos, scale, skew;
-    glm::quat rot;
-    glm::vec4 persp;
-    glm::decompose(trfm3D->local, scale, rot, pos, skew, persp);
+    // Work on copies, written back through a patch
+    glm::vec3 pos = trfm3D->pos();
+    glm::quat rot = trfm3D->rot();
+    glm::vec3 scale = trfm3D->scl();
 
     static glm::quat initialRotation;
     static bool isDraggingRotation = false;
@@ -2216,16 +2215,16 @@ static void RenderTRANFM3D(const Asc::FS& fs, rtScene* scene, Asc::Handle nHandl
         changed = true;
     }
 
-    // Recompose transform if changed
+    // Write back if changed (patch so the world follows)
     if (changed) {
-        trfm3D->local = glm::translate(glm::mat4(1.0f), pos) * 
-                        glm::mat4_cast(rot) * 
-                        glm::scale(glm::mat4(1.0f), scale);
+        trfm3D = scene->nPatchComp<rtTRANFM3D>(nHandle);
+        trfm3D->setPos(pos).setRot(rot).setScl(scale);
     }
 
     ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.6f, 0.2f, 0.2f, 1.0f));
     if (ImGui::Button("Reset", ImVec2(-1, 0))) {
-        trfm3D->local = glm::mat4(1.0f);
+        trfm3D = scene->nPatchComp<rtTRANFM3D>(nHandle);
+        trfm3D->setPos(glm::vec3(0.0f)).setRot(glm::quat(1.0f, 0.0f, 0.0f, 0.0f)).setScl(glm::vec3(1.0f));
         displayEuler = glm::vec3(0.0f);
     }
     ImGui::PopStyleColor();
@@ -2257,7 +2256,7 @@ static void RenderMESHRD3D(const Asc::FS& fs, rtScene* scene, Asc::Handle nHandl
         },
         ImVec4(0.2f, 0.2f, 0.2f, 1.0f),
         [mesh]() { return mesh != nullptr; },
-        [&fs, meshRD]() {
+        [&fs, scene, nHandle]() {
             if (ImGui::BeginDragDropTarget()) {
                 if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("PAYLOAD")) {
                     Payload* data = (Payload*)payload->Data;
@@ -2269,7 +2268,8 @@ static void RenderMESHRD3D(const Asc::FS& fs, rtScene* scene, Asc::Handle nHandl
                     const tinyMesh* rMesh = fs.rGet<tinyMesh>(dHandle);
                     if (!rMesh) { ImGui::EndDragDropTarget(); return; }
 
-                    meshRD->assignMesh(dHandle, rMesh);
+                    // Patched so the bounds and the retained list pick up the swap
+                    scene->nPatchComp<rtMESHRD3D>(nHandle)->assignMesh(dHandle, rMesh);
 
                     ImGui::EndDragDropTarget();
                 }
@@ -2308,11 +2308,11 @@ static void RenderMESHRD3D(const Asc::FS& fs, rtScene* scene, Asc::Handle nHandl
                 Payload* data = (Payload*)payload->Data;
                 if (!data->is<rtNode>()) { ImGui::EndDragDropTarget(); return; }
 
-                Asc::Handle nHandle = data->handle;
-                rtSKELE3D* skel3D = scene->nGetComp<rtSKELE3D>(nHandle);
+                Asc::Handle skeleHandle = data->handle;
+                rtSKELE3D* skel3D = scene->nGetComp<rtSKELE3D>(skeleHandle);
                 if (!skel3D || !skel3D->rSkeleton()) { ImGui::EndDragDropTarget(); return; }
 
-                meshRD->assignSkeleNode(nHandle);
+                scene->nPatchComp<rtMESHRD3D>(nHandle)->assignSkeleNode(skeleHandle);
 
                 ImGui::EndDragDropTarget();
             }
@@ -2334,19 +2334,23 @@ static void RenderMESHRD3D(const Asc::FS& fs, rtScene* scene, Asc::Handle nHandl
         }
     );
 
+    bool isStatic = meshRD->isStatic();
+    if (ImGui::Checkbox("Static", &isStatic)) scene->nPatchComp<rtMESHRD3D>(nHandle)->setStatic(isStatic);
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("Retained by the renderer, no per-frame culling or submit");
+
     // Morph target editor button
-    if (mesh && !mesh->mrphTargetInfos().empty() && !meshRD->mrphWeights().empty()) {
+    if (mesh && !mesh->mrphTargetInfos().empty() && !meshRD->cMrphWeights().empty()) {
         ImGui::Separator();
         
         ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.8f, 0.5f, 0.3f, 1.0f));
         ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.9f, 0.6f, 0.4f, 1.0f));
         ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.7f, 0.4f, 0.2f, 1.0f));
         
-        std::string buttonLabel = "Open Morph Target Editor (" + std::to_string(meshRD->mrphWeights().size()) + " targets)";
+        std::string buttonLabel = "Open Morph Target Editor (" + std::to_string(meshRD->cMrphWeights().size()) + " targets)";
         if (ImGui::Button(buttonLabel.c_str(), ImVec2(-1, 0))) {
             // Create and open morph editor tab
             rtNode* node = scene->node(nHandle);
-            std::string tabTitle = "Morph: " + (node ? node->name : "Unknown");
+            std::string tabTitle = "Morph: " + (node ? node->name() : "Unknown");
             Editor::Tab morphTab = CreateRtMorphTargetEditorTab(tabTitle, nHandle, State::sceneHandle);
             Editor::addTab(morphTab);
         }
@@ -2481,7 +2485,7 @@ static void RenderSCRIPT(const Asc::FS& fs, rtScene* scene, Asc::Handle nHandle)
     if (!scriptPtr) return; // No valid script assigned
 
     if (ImGui::Button("Open RtScript in Editor", ImVec2(-1, 0))) {
-        std::string title = node->name;
+        std::string title = node->name();
         title += " [" + std::to_string(nHandle.idx()) + ", " + std::to_string(nHandle.ver()) + "] Script";
 
         Editor::addTab(CreateRtScriptEditorTab(title, nHandle, State::sceneHandle));
@@ -2765,6 +2769,106 @@ static void RenderFileInspector(tinyProject* project) {
     }
 }
 
+// ===== MEMORY STATS =====
+
+static float ToKB(size_t bytes) { return static_cast<float>(bytes) / 1024.0f; }
+
+static void RenderPoolStatsRow(const char* name, const Asc::PoolStats& st) {
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn(); ImGui::TextUnformatted(name);
+    ImGui::TableNextColumn(); ImGui::Text("%u / %u", st.count, st.capacity);
+    ImGui::TableNextColumn(); ImGui::Text("%u", st.freeSlots);
+    ImGui::TableNextColumn(); ImGui::Text("%.1f", ToKB(st.denseBytes));
+    ImGui::TableNextColumn(); ImGui::Text("%.1f", ToKB(st.sparseBytes + st.freeBytes));
+
+    // Slack above a third of the pool is worth a look
+    ImGui::TableNextColumn();
+    bool wasteful = st.slackBytes * 3 > st.totalBytes() && st.totalBytes() > 64 * 1024;
+    if (wasteful) ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "%.1f", ToKB(st.slackBytes));
+    else          ImGui::Text("%.1f", ToKB(st.slackBytes));
+
+    ImGui::TableNextColumn(); ImGui::Text("%.1f", ToKB(st.totalBytes()));
+}
+
+static bool BeginPoolStatsTable(const char* id) {
+    if (!ImGui::BeginTable(id, 7, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp)) return false;
+
+    ImGui::TableSetupColumn("Pool");
+    ImGui::TableSetupColumn("Live / Cap");
+    ImGui::TableSetupColumn("Free");
+    ImGui::TableSetupColumn("Dense KB");
+    ImGui::TableSetupColumn("Sparse KB");
+    ImGui::TableSetupColumn("Slack KB");
+    ImGui::TableSetupColumn("Total KB");
+    ImGui::TableHeadersRow();
+    return true;
+}
+
+static void RenderRegStats(const char* id, const Asc::Reg& reg, const char* extraName = nullptr, const Asc::PoolStats* extra = nullptr) {
+    if (!BeginPoolStatsTable(id)) return;
+
+    if (extra) RenderPoolStatsRow(extraName, *extra);
+    for (const auto& info : reg.poolStats()) RenderPoolStatsRow(info.name, info.stats);
+
+    ImGui::EndTable();
+}
+
+static void RenderMemoryStats(tinyProject* project) {
+    const Asc::FS& fs = project->fs();
+    Asc::FS::Stats fsStats = fs.stats();
+
+    // Sum over every scene, not just the active one
+    Asc::PoolStats sceneTotal;
+    const auto& scenes = fs.r().view<rtScene>();
+    scenes.forEach([&](const rtScene& scene, uint32_t) {
+        sceneTotal += scene.nodeStats();
+        sceneTotal += scene.rt().totalStats();
+    });
+
+    size_t grandTotal = fsStats.nodes.totalBytes() + fsStats.data.totalBytes() + fsStats.indexBytes + sceneTotal.totalBytes();
+
+    // Sampled once a second, enough to spot a leak during long sessions
+    static float history[120] = {};
+    static int historyHead = 0;
+    static float sampleTimer = 0.0f;
+    sampleTimer += ImGui::GetIO().DeltaTime;
+    if (sampleTimer >= 1.0f) {
+        sampleTimer = 0.0f;
+        history[historyHead] = ToKB(grandTotal);
+        historyHead = (historyHead + 1) % IM_ARRAYSIZE(history);
+    }
+
+    ImGui::Text("Total: %.1f KB (pool bookkeeping only, element heap not counted)", ToKB(grandTotal));
+    ImGui::PlotLines("##MemHistory", history, IM_ARRAYSIZE(history), historyHead, nullptr, 0.0f, FLT_MAX, ImVec2(-1.0f, 48.0f));
+
+    if (ImGui::CollapsingHeader("File System", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Text("Name index: %zu entries, ~%.1f KB", fsStats.indexEntries, ToKB(fsStats.indexBytes));
+        RenderRegStats("FSPools", fs.r(), "(file nodes)", &fsStats.nodes);
+    }
+
+    if (ImGui::CollapsingHeader("Scenes", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Text("%u scene(s), %.1f KB", scenes.count(), ToKB(sceneTotal.totalBytes()));
+
+        for (uint32_t i = 0; i < scenes.count(); ++i) {
+            const rtScene& scene = scenes.data()[i];
+            Asc::Handle dHandle = scenes.handleAt(i);
+            Asc::Handle fHandle = fs.rDataToFile(dHandle);
+
+            const char* label = fHandle ? fs.nameCStr(fHandle) : "(unnamed)";
+            ImGui::PushID(static_cast<int>(i));
+
+            bool isActive = dHandle == State::sceneHandle;
+            if (ImGui::TreeNodeEx(label, isActive ? ImGuiTreeNodeFlags_DefaultOpen : 0)) {
+                Asc::PoolStats nodeStats = scene.nodeStats();
+                RenderRegStats("ScenePools", scene.rt(), "(nodes)", &nodeStats);
+                ImGui::TreePop();
+            }
+
+            ImGui::PopID();
+        }
+    }
+}
+
 static void RenderInspector(tinyProject* project) {
     RenderSceneNodeInspector(project);
     RenderFileInspector(project);
@@ -2792,6 +2896,15 @@ void tinyApp::renderUI() {
     Asc::FS& fs = project->fs();
 
 
+    // ===== MEMORY STATS WINDOW =====
+    static bool showMemoryStats = false;
+    if (showMemoryStats) {
+        if (tinyUI::Begin("Memory Stats", &showMemoryStats)) {
+            RenderMemoryStats(project.get());
+            tinyUI::End();
+        }
+    }
+
     // ===== THEME EDITOR WINDOW =====
     static bool showThemeEditor = false;
     if (showThemeEditor) {
@@ -2877,6 +2990,13 @@ void tinyApp::renderUI() {
             if (ImGui::Button("Theme Editor")) {
                 showThemeEditor = !showThemeEditor;
             }
+            ImGui::SameLine();
+            if (ImGui::Button("Memory Stats")) {
+                showMemoryStats = !showMemoryStats;
+            }
+
+            // Parallel pool loops go serial and in order, for chasing races
+            ImGui::Checkbox("Deterministic", &Asc::parallelDeterministic);
 
             ImGui::EndChild();
             ImGui::PopStyleColor();
@@ -3050,8 +3170,8 @@ void tinyApp::renderUI() {
                         (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 100.0f
                     );
 
-                    rtTRANFM3D* transf = curScene->nGetComp<rtTRANFM3D>(nodeHdl);
-                    if (transf) transf->local = glm::translate(glm::mat4(1.0f), randPos);
+                    rtTRANFM3D* transf = curScene->nPatchComp<rtTRANFM3D>(nodeHdl);
+                    if (transf) *transf = rtTRANFM3D().setPos(randPos);
                 }
             }
         }
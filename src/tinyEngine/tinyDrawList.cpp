@@ -0,0 +1,231 @@
+#include "tinyEngine/tinyDrawList.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+tinyDrawList::tinyDrawList(float cellSize) noexcept
+: cellSize_(cellSize > 0.0f ? cellSize : 64.0f) {
+    static std::atomic<uint64_t> nextId{ 1 };
+    id_ = nextId++;
+}
+
+Asc::Handle tinyDrawList::add(Asc::Handle mesh, const glm::mat4& model) {
+    Asc::Handle item = items_.emplace(Item{});
+    attach(item, mesh, model);
+    return item;
+}
+
+void tinyDrawList::move(Asc::Handle item, const glm::mat4& model) noexcept {
+    const Item* at = items_.get(item);
+    if (!at) return;
+
+    Group& group = groups_[at->group];
+    if (cellOf(model) == group.cell) {
+        group.instaData[at->index].model = model;
+        group.boundsDirty = true;
+        changed(at->group, at->index);
+        return;
+    }
+
+    // Crossed into another cell, the instance changes groups
+    Asc::Handle mesh = group.mesh;
+    detach(*at);
+    attach(item, mesh, model);
+}
+
+void tinyDrawList::remove(Asc::Handle item) noexcept {
+    const Item* found = items_.get(item);
+    if (!found) return;
+
+    detach(*found);
+    items_.erase(item);
+}
+
+glm::ivec3 tinyDrawList::cellOf(const glm::mat4& model) const noexcept {
+    glm::ivec3 cell(0);
+    for (int i = 0; i < 3; ++i) {
+        float c = std::floor(model[3][i] / cellSize_);
+        if (c > -1e9f && c < 1e9f) cell[i] = static_cast<int>(c); // NaN and far out land in 0
+    }
+    return cell;
+}
+
+void tinyDrawList::attach(Asc::Handle item, Asc::Handle mesh, const glm::mat4& model) {
+    GroupKey key{ mesh, cellOf(model) };
+
+    auto it = groupMap_.find(key);
+    uint32_t g = it != groupMap_.end() ? it->second : static_cast<uint32_t>(groups_.size());
+    if (g == groups_.size()) {
+        groupMap_[key] = g;
+        Group& added = groups_.emplace_back();
+        added.mesh = mesh;
+        added.cell = key.cell;
+    }
+
+    Group& group = groups_[g];
+    uint32_t index = static_cast<uint32_t>(group.instaData.size());
+    *items_.get(item) = Item{ g, index };
+
+    tinyInstaData instaData;
+    instaData.model = model;
+    group.instaData.push_back(instaData);
+    group.items.push_back(item);
+    group.boundsDirty = true;
+
+    // Out of room, one relayout at the next submit however many more come
+    if (index >= group.capacity) stale_ = true;
+    else changed(g, index);
+}
+
+void tinyDrawList::detach(const Item& found) noexcept {
+    const Item at = found; // found may point into items_, the fixup below writes there
+    Group& group = groups_[at.group];
+
+    // The last instance fills the hole, the range just gets shorter
+    uint32_t last = static_cast<uint32_t>(group.instaData.size() - 1);
+    if (at.index != last) {
+        group.instaData[at.index] = group.instaData[last];
+        group.items[at.index] = group.items[last];
+        items_.get(group.items[at.index])->index = at.index;
+        changed(at.group, at.index);
+    }
+
+    group.instaData.pop_back();
+    group.items.pop_back();
+    group.boundsDirty = true;
+}
+
+void tinyDrawList::clear() noexcept {
+    items_.clear();
+    groups_.clear();
+    groupMap_.clear();
+    capacity_ = 0;
+    stale_ = false;
+
+    logBase_ += log_.size();
+    log_.clear();
+    ++layout_;
+}
+
+Asc::Handle tinyDrawList::mesh(Asc::Handle item) const noexcept {
+    const Item* at = items_.get(item);
+    return at ? groups_[at->group].mesh : Asc::Handle();
+}
+
+uint32_t tinyDrawList::rangeSize() {
+    if (stale_) relayout();
+    return capacity_;
+}
+
+bool tinyDrawList::Slot::upload(tinyDrawList& list, tinyInstaData* range, uint32_t base, uint32_t keep) {
+    if (records_.size() <= count_) records_.resize(count_ + 1);
+    Record& record = records_[count_++];
+
+    const uint64_t version = list.logBase_ + list.log_.size();
+
+    // Same list in the same spot and shape as this slot last had it, only the changes go in
+    bool delta = record.list == list.id_ && record.layout == list.layout_ &&
+                 record.base == base && record.version >= list.logBase_;
+
+    if (delta) {
+        for (size_t i = record.version - list.logBase_; i < list.log_.size(); ++i) {
+            const Item& changed = list.log_[i];
+            const Group& group = list.groups_[changed.group];
+            if (changed.index >= group.instaData.size()) continue; // Removed since
+
+            range[group.base + changed.index] = group.instaData[changed.index];
+        }
+    } else {
+        for (const Group& group : list.groups_) {
+            std::copy(group.instaData.begin(), group.instaData.end(), range + group.base);
+        }
+    }
+
+    record = { list.id_, list.layout_, version, base };
+    list.submitted(keep);
+    return delta;
+}
+
+void tinyDrawList::changed(uint32_t group, uint32_t index) {
+    if (stale_) return; // The relayout copies everything anyway
+    // Nobody has been picking these up (list not submitted lately), a full copy is cheaper by now
+    if (log_.size() > items_.count() + 1024) {
+        logBase_ += log_.size();
+        log_.clear();
+        ++layout_;
+        return;
+    }
+
+    log_.push_back(Item{ group, index });
+}
+
+void tinyDrawList::relayout() {
+    // Empty groups go, the rest get a little headroom so steady add/remove stays off this path
+    // Kept tight: a list that takes more than the instance buffer falls back to per-frame submits
+    uint32_t kept = 0;
+    groupMap_.clear();
+    capacity_ = 0;
+    stale_ = false;
+
+    for (uint32_t g = 0; g < groups_.size(); ++g) {
+        uint32_t size = static_cast<uint32_t>(groups_[g].instaData.size());
+        if (!size) continue;
+
+        if (kept != g) {
+            groups_[kept] = std::move(groups_[g]);
+            for (Asc::Handle item : groups_[kept].items) items_.get(item)->group = kept;
+        }
+
+        Group& group = groups_[kept];
+        group.base = capacity_;
+        group.capacity = size + size / 8 + 1;
+        capacity_ += group.capacity;
+
+        groupMap_[GroupKey{ group.mesh, group.cell }] = kept++;
+    }
+    groups_.resize(kept);
+
+    // Every instance moved, nothing to diff against
+    logBase_ += log_.size();
+    log_.clear();
+    ++layout_;
+}
+
+void tinyDrawList::refreshBounds(Group& group, const glm::vec3& meshMin, const glm::vec3& meshMax) noexcept {
+    group.boundsDirty = false;
+
+    // Mesh without bounds (no submesh set them), nothing to cull against
+    if (glm::any(glm::greaterThan(meshMin, meshMax))) {
+        group.boundsMin = glm::vec3(1.0f);
+        group.boundsMax = glm::vec3(-1.0f);
+        return;
+    }
+
+    glm::vec3 localCenter = (meshMin + meshMax) * 0.5f;
+    glm::vec3 localHalf   = (meshMax - meshMin) * 0.5f;
+
+    group.boundsMin = glm::vec3( std::numeric_limits<float>::max());
+    group.boundsMax = glm::vec3(-std::numeric_limits<float>::max());
+    for (const tinyInstaData& instaData : group.instaData) {
+        const glm::mat4& model = instaData.model;
+
+        glm::vec3 center = glm::vec3(model * glm::vec4(localCenter, 1.0f));
+        glm::vec3 half = glm::mat3(glm::abs(glm::vec3(model[0])), glm::abs(glm::vec3(model[1])), glm::abs(glm::vec3(model[2]))) * localHalf;
+
+        group.boundsMin = glm::min(group.boundsMin, center - half);
+        group.boundsMax = glm::max(group.boundsMax, center + half);
+    }
+}
+
+void tinyDrawList::submitted(uint32_t keep) {
+    submits_.push_back(logBase_ + log_.size());
+    if (submits_.size() > keep) submits_.erase(submits_.begin());
+
+    // Frame slots still holding one of the last few submits may ask for anything after the oldest
+    if (submits_.front() <= logBase_) return; // A relayout since, already cut back
+
+    size_t drop = static_cast<size_t>(submits_.front() - logBase_);
+    log_.erase(log_.begin(), log_.begin() + drop);
+    logBase_ += drop;
+}
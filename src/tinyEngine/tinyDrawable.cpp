@@ -62,6 +62,8 @@ void tinyDrawable::init(const CreateInfo& info) {
     fsr_ = info.fsr;
     dvk_ = info.dvk;
 
+    listSlots_.resize(maxFramesInFlight_);
+
     VkDevice device = dvk_->device;
     VkPhysicalDevice pDevice = dvk_->pDevice;
 
@@ -188,6 +190,22 @@ void tinyDrawable::init(const CreateInfo& info) {
     mrphWsDescSet_.allocate(device, mrphWsDescPool_, mrphWsDescLayout_);
     writeDescSetDynamicBuffer(mrphWsDescSet_, mrphWsBuffer_, mrphWsSize_x1_.unaligned);
 
+// ------------------ Setup draw data ------------------
+
+    // Indirect commands, offsets only need 4 byte alignment
+    drawSize_x1_.unaligned = MAX_DRAWS * sizeof(VkDrawIndexedIndirectCommand);
+    drawSize_x1_.aligned = drawSize_x1_.unaligned;
+    createBuffer(drawBuffer_, drawSize_x1_.aligned * maxFramesInFlight_, BufferUsage::Indirect, MemProp::HostVisibleAndCoherent);
+
+    drawDataSize_x1_.unaligned = MAX_DRAWS * sizeof(DrawData);
+    drawDataSize_x1_.aligned = dvk_->alignSizeSSBO(drawDataSize_x1_.unaligned);
+    createBuffer(drawDataBuffer_, drawDataSize_x1_.aligned * maxFramesInFlight_, BufferUsage::Storage, MemProp::HostVisibleAndCoherent);
+
+    drawDescLayout_.create(device, { {0, DescType::StorageBufferDynamic, 1, ShaderStage::Vertex, nullptr} });
+    drawDescPool_.create(device, { {DescType::StorageBufferDynamic, 1} }, 1);
+    drawDescSet_.allocate(device, drawDescPool_, drawDescLayout_);
+    writeDescSetDynamicBuffer(drawDescSet_, drawDataBuffer_, drawDataSize_x1_.unaligned);
+
 // -------------------------- Vertex Extension -------------------------
 
     tinyMesh::createVrtxExtDescriptors(dvk_, &vrtxExtLayout_, &vrtxExtPool_);
@@ -278,202 +296,410 @@ void tinyDrawable::startFrame(uint32_t frameIndex) noexcept {
     matData_.clear();
     skinRanges_.clear();
 
-    skinCount_ = 0;
-    mrphWsCount_ = 0;
+    // This frame's slots, everything below writes straight into them
+    auto slot = [](const DataBuffer& buffer, VkDeviceSize offset) -> void* {
+        char* mapped = static_cast<char*>(buffer.getMapped());
+        return mapped ? mapped + offset : nullptr;
+    };
+    instaArena_.reset(slot(instaBuffer_, instaOffset(frameIndex_)), MAX_INSTANCES);
+    skinArena_.reset(slot(skinBuffer_, skinOffset(frameIndex_)), MAX_BONES);
+    mrphWsArena_.reset(slot(mrphWsBuffer_, mrphWsOffset(frameIndex_)), MAX_MORPH_WS);
+    drawArena_.reset(slot(drawBuffer_, drawOffset(frameIndex_)), MAX_DRAWS);
+    drawDataArena_.reset(slot(drawDataBuffer_, drawDataOffset(frameIndex_)), MAX_DRAWS);
+
+    listSlots_[frameIndex_].begin();
+
+    if (buckets_.empty()) buckets_.push_back(std::make_unique<Bucket>());
+    for (uint32_t b = 0; b <= bucketCount_; ++b) buckets_[b]->clear();
+    bucketCount_ = 0;
 
     batchMap_.clear();
     dataMap_.clear();
+    mrphMap_.clear();
 
 // Initialize
     matData_.push_back(tinyMaterial::Data());
 }
 
-void tinyDrawable::submit(const Entry& entry) noexcept {
-    Asc::Handle meshHandle = entry.mesh;
-    size_t submeshIndex = entry.submesh;
+size_t tinyDrawable::shaderGroupFor(Asc::Handle materialHandle) {
+    // Check for material existence as well as getting/creating ShaderGroup
+    auto shaderIt = batchMap_.find(materialHandle); // Material handle -> ShaderGroup index
+    if (shaderIt != batchMap_.end()) return shaderIt->second;
 
-    // Get or create SubmeshGroup
-    Asc::Handle hash = entry.hash();
-    auto subIt = batchMap_.find(hash); // Entry hash -> SubmeshGroup index
+    Asc::Handle shaderHandle;
 
-    if (subIt == batchMap_.end()) {
-        const tinyMesh* rMesh = fsr_->get<tinyMesh>(meshHandle);
-        if (!rMesh) return;
+    // Retrieve submesh's material's shader
+    if (const tinyMaterial* rMat = fsr_->get<tinyMaterial>(materialHandle)) {
 
-        const tinyMesh::Submesh* submesh = rMesh->submesh(submeshIndex);
-        if (!submesh) return;
+        // If material not in buffer, add it
+        if (dataMap_.find(materialHandle) == dataMap_.end()) { //
+            dataMap_[materialHandle] = matData_.size();
+            
+            tinyMaterial::Data matData;
+
+            matData.float1 = rMat->baseColor;
 
-        Asc::Handle materialHandle = submesh->material;
+            matData.uint1.x = getTextureIndex(rMat->albTexture);
+            matData.uint1.y = getTextureIndex(rMat->nrmlTexture);
+            matData.uint1.z = getTextureIndex(rMat->emissTexture);
 
-        // Check for material existence as well as getting/creating ShaderGroup
-        auto shaderIt = batchMap_.find(materialHandle); // Material handle -> ShaderGroup index
-        if (shaderIt == batchMap_.end()) {
-            Asc::Handle shaderHandle;
+            matData_.push_back(matData);
+        }
 
-            // Retrieve submesh's material's shader
-            if (const tinyMaterial* rMat = fsr_->get<tinyMaterial>(materialHandle)) {
+        shaderHandle = rMat->shader;
+    }
 
-                // If material not in buffer, add it
-                if (dataMap_.find(materialHandle) == dataMap_.end()) { //
-                    dataMap_[materialHandle] = matData_.size();
-                    
-                    tinyMaterial::Data matData;
+    // Get or create ShaderGroup
+    shaderIt = batchMap_.find(shaderHandle);
+    if (shaderIt == batchMap_.end()) {
+        size_t shaderGroupIdx = shaderGroups_.size();
+        batchMap_[shaderHandle] = shaderGroupIdx;
 
-                    matData.float1 = rMat->baseColor;
+        shaderGroups_.emplace_back();
+        shaderGroups_.back().shader = shaderHandle;
 
-                    matData.uint1.x = getTextureIndex(rMat->albTexture);
-                    matData.uint1.y = getTextureIndex(rMat->nrmlTexture);
-                    matData.uint1.z = getTextureIndex(rMat->emissTexture);
+        shaderIt = batchMap_.find(shaderHandle);
+    }
 
-                    matData_.push_back(matData);
-                }
+    // Update Material handle -> ShaderGroup index map
+    size_t shaderGroupIdx = shaderIt->second;
+    batchMap_[materialHandle] = shaderGroupIdx;
+    return shaderGroupIdx;
+}
 
-                shaderHandle = rMat->shader;
-            }
+size_t tinyDrawable::meshGroupFor(size_t shaderGroupIdx, Asc::Handle meshHandle) {
+    ShaderGroup& shaderGroup = shaderGroups_[shaderGroupIdx];
 
-            // Get or create ShaderGroup
-            shaderIt = batchMap_.find(shaderHandle);
-            if (shaderIt == batchMap_.end()) {
-                size_t shaderGroupIdx = shaderGroups_.size();
-                batchMap_[shaderHandle] = shaderGroupIdx;
+    // Get or create MeshGroup
+    auto meshIt = shaderGroup.meshGroupMap.find(meshHandle);
+    if (meshIt != shaderGroup.meshGroupMap.end()) return meshIt->second;
 
-                shaderGroups_.emplace_back();
-                shaderGroups_.back().shader = shaderHandle;
+    size_t meshGroupIdx = meshGroups_.size();
+    shaderGroup.meshGroupMap[meshHandle] = meshGroupIdx;
+    shaderGroup.meshGroupIndices.push_back(meshGroupIdx);
 
-                shaderIt = batchMap_.find(shaderHandle);
-            }
+    meshGroups_.emplace_back();
+    meshGroups_.back().mesh = meshHandle;
+    return meshGroupIdx;
+}
 
-            // Update Material handle -> ShaderGroup index map
-            batchMap_[materialHandle] = shaderIt->second;
-        }
+void tinyDrawable::submit(const Entry& entry) noexcept {
+    buckets_[0]->submit(entry);
+}
+
+void tinyDrawable::openBuckets(uint32_t count) {
+    while (buckets_.size() <= count) {
+        buckets_.push_back(std::make_unique<Bucket>());
+        buckets_.back()->index_ = static_cast<uint32_t>(buckets_.size() - 1);
+    }
+    bucketCount_ = std::max(bucketCount_, count);
+}
+
+void tinyDrawable::Bucket::submit(const Entry& entry) noexcept {
+    // Past the key's 16 bits no real mesh gets there, and a null handle would spread the sort over every byte
+    if (!entry.mesh || entry.submesh > 0xFFFF) return;
 
-        ShaderGroup& shaderGroup = shaderGroups_[shaderIt->second];
+    // Add instance data
+    InstaData instaData;
+    instaData.model = entry.model;
 
-        // Get or create MeshGroup
-        auto meshIt = shaderGroup.meshGroupMap.find(meshHandle);
-        if (meshIt == shaderGroup.meshGroupMap.end()) {
-            size_t meshGroupIdx = meshGroups_.size();
-            shaderGroup.meshGroupMap[meshHandle] = meshGroupIdx;
-            shaderGroup.meshGroupIndices.push_back(meshGroupIdx);
+    // If mesh entry uses a skeleton from a skeleton node, one ref per node
+    const Entry::SkeleData& skeleData = entry.skeleData;
+    if (skeleData.skinData && !skeleData.skinData->empty()) {
+        auto [skinIt, added] = skinMap_.try_emplace(skeleData.skeleNode, static_cast<uint32_t>(skins_.size()));
+        if (added) skins_.push_back(skeleData);
 
-            meshGroups_.emplace_back();
-            meshGroups_.back().mesh = meshHandle;
+        instaData.other.x = skinIt->second;
+        instaData.other.y = static_cast<uint32_t>(skeleData.skinData->size());
+    }
 
-            meshIt = shaderGroup.meshGroupMap.find(meshHandle);
-        }
+    // If mesh has morph targets (node-level, each node has its own morph weights)
+    const Entry::MorphData& morphData = entry.morphData;
+    if (morphData.weights && !morphData.weights->empty()) {
+        auto [mrphIt, added] = mrphMap_.try_emplace(morphData.node, static_cast<uint32_t>(morphs_.size()));
+        if (added) morphs_.push_back(morphData);
+
+        instaData.other.z = mrphIt->second;
+        instaData.other.w = static_cast<uint32_t>(morphData.weights->size());
+    }
 
-        MeshGroup& meshGroup = meshGroups_[meshIt->second];
+    // Grouping waits for finalize
+    keyed_.push_back({ sortKey(entry.mesh, static_cast<uint32_t>(entry.submesh)), static_cast<uint32_t>(instaData_.size()), index_ });
+    instaData_.push_back(instaData);
+}
 
-        // Get or create SubmeshGroup (likely creating)
-        auto submeshIt = meshGroup.submeshGroupMap.find(submeshIndex);
-        if (submeshIt == meshGroup.submeshGroupMap.end()) {
-            size_t submeshGroupIdx = submeshGroups_.size();
-            meshGroup.submeshGroupMap[submeshIndex] = submeshGroupIdx;
-            meshGroup.submeshGroupIndices.push_back(submeshGroupIdx);
+void tinyDrawable::Bucket::clear() noexcept {
+    keyed_.clear();
+    instaData_.clear();
 
-            submeshGroups_.emplace_back();
+    skins_.clear();
+    morphs_.clear();
+    skinMap_.clear();
+    mrphMap_.clear();
+}
 
-            submeshIt = meshGroup.submeshGroupMap.find(submeshIndex);
-        }
+uint32_t tinyDrawable::skinOffsetFor(const Entry::SkeleData& skeleData) {
+    Asc::Handle skeleNode = skeleData.skeleNode;
 
-        SubmeshGroup& submeshGroup = submeshGroups_[submeshIt->second];
-        submeshGroup.submesh = submeshIndex;
+    // If this skeleton node already registered, use existing range
+    auto skinRangeIt = dataMap_.find(skeleNode);
+    if (skinRangeIt != dataMap_.end()) return skinRanges_[skinRangeIt->second].skinOffset;
 
-        // Add hash entry to batch map
-        batchMap_[hash] = submeshIt->second;
-        subIt = batchMap_.find(hash);
+    uint32_t thisCount = static_cast<uint32_t>(skeleData.skinData->size());
+
+    SkinRange newRange;
+    newRange.skinCount = thisCount;
+
+    // Palette straight into the frame slot
+    if (glm::mat4* dst = skinArena_.alloc(thisCount, newRange.skinOffset)) {
+        std::copy(skeleData.skinData->begin(), skeleData.skinData->end(), dst);
+    } else {
+        newRange.skinOffset = NO_RANGE;
     }
 
-    SubmeshGroup& submeshGroup = submeshGroups_[subIt->second];
+    // Append range
+    dataMap_[skeleNode] = skinRanges_.size();
+    skinRanges_.push_back(newRange);
 
-    // Add instance data
-    InstaData instaData;
-    instaData.model = entry.model;
+    return newRange.skinOffset;
+}
 
-    // If mesh entry uses a skeleton from a skeleton node
-    const Entry::SkeleData& skeleData = entry.skeleData;
-    if (skeleData.skinData && !skeleData.skinData->empty()) {
-        Asc::Handle skeleNode = skeleData.skeleNode;
+uint32_t tinyDrawable::mrphOffsetFor(const Entry::MorphData& morphData) {
+    Asc::Handle nodeHandle = morphData.node;
 
-        // If this skeleton node already registered, use existing range
-        auto skinRangeIt = dataMap_.find(skeleNode);
-        if (skinRangeIt == dataMap_.end()) {
-            uint32_t thisCount = skeleData.skinData->size();
+    // Check if we've already copied this node's morph weights
+    auto mrphIt = mrphMap_.find(nodeHandle);
+    if (mrphIt != mrphMap_.end()) return mrphIt->second;
 
-            SkinRange newRange;
-            newRange.skinOffset = skinCount_;
-            newRange.skinCount = thisCount;
+    uint32_t thisCount = static_cast<uint32_t>(morphData.weights->size());
 
-            // Append range
-            dataMap_[skeleNode] = skinRanges_.size();
-            skinRanges_.push_back(newRange);
+    // This node's morph weight array, straight into the frame slot
+    uint32_t mrphOffset = NO_RANGE;
+    if (float* dst = mrphWsArena_.alloc(thisCount, mrphOffset)) {
+        std::copy(morphData.weights->begin(), morphData.weights->end(), dst);
+    }
 
-            // Copy skin data
-            size_t skinDataSize   = thisCount  * sizeof(glm::mat4);
-            size_t skinDataOffset = skinCount_ * sizeof(glm::mat4) + skinOffset(frameIndex_);
-            skinBuffer_.copyData(skeleData.skinData->data(), skinDataSize, skinDataOffset);
+    // Store the offset for this node
+    mrphMap_[nodeHandle] = mrphOffset;
+    return mrphOffset;
+}
 
-            skinRangeIt = dataMap_.find(skeleNode);
+void tinyDrawable::submit(List& list, const tinyCamera* camera) noexcept {
+    const uint32_t rangeSize = list.rangeSize();
 
-            skinCount_ += thisCount;
-        }
+    // Refreshed even for a list that won't fit, the fallback below culls with them too
+    auto visible = [&](List::Group& group, const tinyMesh& rMesh) {
+        if (!camera) return true;
+        if (group.boundsDirty) list.refreshBounds(group, rMesh.ABmin(), rMesh.ABmax());
+        if (glm::any(glm::greaterThan(group.boundsMin, group.boundsMax))) return true;
+        return camera->collideAABB(group.boundsMin, group.boundsMax, glm::mat4(1.0f));
+    };
 
-        SkinRange& skinRange = skinRanges_[skinRangeIt->second];
-        instaData.other.x = skinRange.skinOffset;
-        instaData.other.y = skinRange.skinCount;
+    uint32_t base = 0;
+    InstaData* range = instaArena_.alloc(rangeSize, base);
+    if (!range) {
+        // No room for the whole range, what's in view goes through the per-frame path instead
+        for (List::Group& group : list.groups_) {
+            const tinyMesh* rMesh = fsr_->get<tinyMesh>(group.mesh);
+            if (group.instaData.empty() || !rMesh || !visible(group, *rMesh)) continue;
+
+            for (const InstaData& instaData : group.instaData) {
+                Entry entry;
+                entry.mesh = group.mesh;
+                entry.model = instaData.model;
+                for (size_t subIdx = 0; subIdx < rMesh->submeshes().size(); ++subIdx) {
+                    entry.submesh = subIdx;
+                    submit(entry);
+                }
+            }
+        }
+        return;
     }
 
-    // If mesh has morph targets (node-level, each node has its own morph weights)
-    const Entry::MorphData& morphData = entry.morphData;
-    if (morphData.weights && !morphData.weights->empty()) {
-        Asc::Handle nodeHandle = entry.morphData.node;
+    // Culled groups are written all the same, the range has to stay whole for the next delta
+    listSlots_[frameIndex_].upload(list, range, base, maxFramesInFlight_);
 
-        // Check if we've already copied this node's morph weights
-        auto mrphIt = dataMap_.find(nodeHandle);
-        if (mrphIt == dataMap_.end()) {
-            uint32_t thisCount = static_cast<uint32_t>(morphData.weights->size());
+    // Every submesh draws the whole group
+    for (List::Group& group : list.groups_) {
+        if (group.instaData.empty()) continue;
 
-            // Copy this node's morph weight array
-            size_t mrphWsDataSize = thisCount * sizeof(float);
-            size_t mrphWsDataOffset = mrphWsCount_ * sizeof(float) + mrphWsOffset(frameIndex_);
-            mrphWsBuffer_.copyData(morphData.weights->data(), mrphWsDataSize, mrphWsDataOffset);
-    
-            // Store the offset for this node
-            dataMap_[nodeHandle] = mrphWsCount_;
-            mrphIt = dataMap_.find(nodeHandle);
+        const tinyMesh* rMesh = fsr_->get<tinyMesh>(group.mesh);
+        if (!rMesh || !visible(group, *rMesh)) continue;
+
+        for (size_t subIdx = 0; subIdx < rMesh->submeshes().size(); ++subIdx) {
+            size_t meshGroupIdx = meshGroupFor(shaderGroupFor(rMesh->submesh(subIdx)->material), group.mesh);
+            meshGroups_[meshGroupIdx].submeshGroupIndices.push_back(submeshGroups_.size());
 
-            mrphWsCount_ += thisCount;
+            SubmeshGroup& smGroup = submeshGroups_.emplace_back();
+            smGroup.submesh = static_cast<uint32_t>(subIdx);
+            smGroup.instaOffset = base + group.base;
+            smGroup.instaCount = static_cast<uint32_t>(group.instaData.size());
+            smGroup.retained = true;
         }
-        
-        // All submeshes of this node reference the same morph weights
-        uint32_t mrphOffset = mrphIt->second;
-        uint32_t mrphCount = static_cast<uint32_t>(morphData.weights->size());
-        
-        instaData.other.z = mrphOffset;
-        instaData.other.w = mrphCount;
+    }
+}
+
+void tinyDrawable::sortKeyed(std::vector<Keyed>& keyed, std::vector<Keyed>& swap) noexcept {
+    const size_t count = keyed.size();
+    if (count < 2) return;
+
+    // Only the bytes some key disagrees on need a pass, handles are small so that's two or three
+    uint64_t diff = 0;
+    for (const Keyed& k : keyed) diff |= k.key ^ keyed[0].key;
+
+    int shifts[8];
+    int passes = 0;
+    for (int b = 0; b < 8; ++b) {
+        if ((diff >> (b * 8)) & 0xFF) shifts[passes++] = b * 8;
+    }
+    if (!passes) return;
+
+    // Every pass's histogram in one read
+    std::vector<uint32_t> hist(passes * 256, 0);
+    for (const Keyed& k : keyed) {
+        for (int p = 0; p < passes; ++p) ++hist[p * 256 + ((k.key >> shifts[p]) & 0xFF)];
     }
 
-    submeshGroup.push(instaData);
+    swap.resize(count);
+
+    // LSD, stable, so submit order holds within a key
+    for (int p = 0; p < passes; ++p) {
+        uint32_t* bucket = &hist[p * 256];
+
+        uint32_t sum = 0;
+        for (int i = 0; i < 256; ++i) {
+            uint32_t c = bucket[i];
+            bucket[i] = sum;
+            sum += c;
+        }
+
+        for (const Keyed& k : keyed) swap[bucket[(k.key >> shifts[p]) & 0xFF]++] = k;
+        keyed.swap(swap);
+    }
 }
 
 void tinyDrawable::finalize() noexcept {
-    uint32_t curInstances = 0;
+    // Per frame instances go in after the lists, over whatever spots the slot had past them
+    listSlots_[frameIndex_].end();
+
+    // Buckets in order: skin and morph ranges land where one serial pass would have put them
+    keyed_.clear();
+    for (uint32_t b = 0; b <= bucketCount_; ++b) {
+        Bucket& bucket = *buckets_[b];
+
+        bucket.skinOffsets_.resize(bucket.skins_.size());
+        for (size_t i = 0; i < bucket.skins_.size(); ++i) {
+            bucket.skinOffsets_[i] = skinOffsetFor(bucket.skins_[i]);
+        }
+
+        bucket.mrphOffsets_.resize(bucket.morphs_.size());
+        for (size_t i = 0; i < bucket.morphs_.size(); ++i) {
+            bucket.mrphOffsets_[i] = mrphOffsetFor(bucket.morphs_[i]);
+        }
+
+        keyed_.insert(keyed_.end(), bucket.keyed_.begin(), bucket.keyed_.end());
+    }
 
-    for (auto& shaderGroup : shaderGroups_) {
-        for (auto& meshGroupIdx : shaderGroup.meshGroupIndices) {
-            MeshGroup& mGroup = meshGroups_[meshGroupIdx];
+    sortKeyed(keyed_, keyedSwap_);
 
-            for (auto& submeshGroupIdx : mGroup.submeshGroupIndices) {
-                SubmeshGroup& smGroup = submeshGroups_[submeshGroupIdx];
+    // One SubmeshGroup per run of equal keys
+    for (size_t begin = 0, end = 0; begin < keyed_.size(); begin = end) {
+        const uint64_t key = keyed_[begin].key;
+        while (end < keyed_.size() && keyed_[end].key == key) ++end;
 
-                smGroup.instaOffset = curInstances;
-                smGroup.instaCount = smGroup.size();
+        Asc::Handle meshHandle = Asc::Handle::make<tinyMesh>(
+            static_cast<uint32_t>(key >> 32), static_cast<uint16_t>(key >> 16)
+        );
+        uint32_t submeshIndex = static_cast<uint32_t>(key & 0xFFFF);
 
-                // Copy instance data to buffer
-                size_t dataOffset = curInstances * sizeof(InstaData) + instaOffset(frameIndex_);
-                instaBuffer_.copyData(smGroup.instaData.data(), smGroup.sizeBytes(), dataOffset);
+        const tinyMesh* rMesh = fsr_->get<tinyMesh>(meshHandle);
+        if (!rMesh) continue;
 
-                curInstances += smGroup.size();
+        const tinyMesh::Submesh* submesh = rMesh->submesh(submeshIndex);
+        if (!submesh) continue;
+
+        // Runs land back to back after the retained ranges
+        uint32_t instaCount = static_cast<uint32_t>(std::min<size_t>(end - begin, instaArena_.left()));
+        uint32_t runOffset = 0;
+        InstaData* out = instaArena_.alloc(instaCount, runOffset);
+        if (!out || !instaCount) break;
+
+        size_t meshGroupIdx = meshGroupFor(shaderGroupFor(submesh->material), meshHandle);
+        meshGroups_[meshGroupIdx].submeshGroupIndices.push_back(submeshGroups_.size());
+
+        SubmeshGroup& smGroup = submeshGroups_.emplace_back();
+        smGroup.submesh = submeshIndex;
+        smGroup.instaOffset = runOffset;
+        smGroup.instaCount = instaCount;
+
+        // Submit order is scattered by now, fetch a few ahead
+        for (size_t i = begin; i < begin + instaCount; ++i) {
+            if (i + 8 < end) {
+                const Keyed& ahead = keyed_[i + 8];
+                TINY_PREFETCH(&buckets_[ahead.bucket]->instaData_[ahead.insta]);
+            }
+
+            const Bucket& bucket = *buckets_[keyed_[i].bucket];
+            InstaData instaData = bucket.instaData_[keyed_[i].insta];
+
+            // Local refs to buffer offsets, whatever didn't fit draws without
+            if (instaData.other.y) {
+                instaData.other.x = bucket.skinOffsets_[instaData.other.x];
+                if (instaData.other.x == NO_RANGE) instaData.other.x = instaData.other.y = 0;
+            }
+            if (instaData.other.w) {
+                instaData.other.z = bucket.mrphOffsets_[instaData.other.z];
+                if (instaData.other.z == NO_RANGE) instaData.other.z = instaData.other.w = 0;
+            }
+
+            *out++ = instaData; // Written once, local until then
+        }
+    }
+
+    // Indirect draws: a mesh group's commands back to back, so one call covers the group
+    for (const ShaderGroup& shaderGroup : shaderGroups_) {
+        for (size_t meshGroupIdx : shaderGroup.meshGroupIndices) {
+            MeshGroup& meshGroup = meshGroups_[meshGroupIdx];
+            meshGroup.drawCount = 0;
+
+            const tinyMesh* rMesh = fsr_->get<tinyMesh>(meshGroup.mesh);
+            if (!rMesh) continue;
+
+            // Out of draws = the tail of this frame goes undrawn
+            uint32_t drawCount = static_cast<uint32_t>(std::min<size_t>(meshGroup.submeshGroupIndices.size(), drawArena_.left()));
+            uint32_t dataOffset = 0;
+            VkDrawIndexedIndirectCommand* cmds = drawArena_.alloc(drawCount, meshGroup.drawOffset);
+            DrawData* datas = drawDataArena_.alloc(drawCount, dataOffset);
+            if (!cmds || !datas || !drawCount) break;
+            meshGroup.drawCount = drawCount;
+
+            for (uint32_t i = 0; i < drawCount; ++i) {
+                const SubmeshGroup& smGroup = submeshGroups_[meshGroup.submeshGroupIndices[i]];
+
+                // Missing submesh still takes its slot, zero instances draws nothing
+                VkDrawIndexedIndirectCommand cmd{};
+                DrawData data;
+
+                if (const tinyMesh::Submesh* submesh = rMesh->submesh(smGroup.submesh)) {
+                    cmd.indexCount    = submesh->indxCount;
+                    cmd.instanceCount = smGroup.instaCount;
+                    cmd.firstIndex    = submesh->indxOffset;
+                    cmd.vertexOffset  = static_cast<int32_t>(submesh->vstaticOffset);
+                    cmd.firstInstance = smGroup.instaOffset;
+
+                    data.data0 = glm::uvec4(
+                        submesh->vrtxFlags(), submesh->vrtxCount,
+                        submesh->mrphTargetCount, matIndex(submesh->material)
+                    );
+                    data.data1 = glm::uvec4(
+                        submesh->vstaticOffset, submesh->vriggedOffset,
+                        submesh->vcolorOffset,  submesh->vmrphsOffset
+                    );
+                    data.data2 = glm::uvec4(submesh->mrphTargetCount, 0, 0, 0);
+                }
+
+                *cmds++ = cmd;
+                *datas++ = data;
             }
         }
     }
@@ -481,4 +707,4 @@ void tinyDrawable::finalize() noexcept {
     size_t matDataOffset = matOffset(frameIndex_); // Aligned
     size_t matDataSize = matData_.size() * sizeof(tinyMaterial::Data); // True size
     matBuffer_.copyData(matData_.data(), matDataSize, matDataOffset);
-}
\ No newline at end of file
+}
@@ -135,7 +135,7 @@ Asc::Handle tinyProject::addModel(tinyModel& model, Asc::Handle parentFolder) {
 
         if (ogNode.hasTRFM3D()) {
             rtTRANFM3D* trfm = scene.nWriteComp<rtTRANFM3D>(nodeHandle);
-            trfm->local = ogNode.TRFM3D;
+            trfm->set(ogNode.TRFM3D);
         }
 
         if (ogNode.hasMESHR()) {
@@ -168,7 +168,7 @@ Asc::Handle tinyProject::addModel(tinyModel& model, Asc::Handle parentFolder) {
     addNodeRecursive(0, Asc::Handle());
 
     // Rename the root node to the model's name
-    scene.root()->name = model.name;
+    scene.nRename(scene.rootHandle(), model.name);
 
     // Add scene to registry
     Asc::Handle fnHandle = fs_->createFile(model.name, std::move(scene), fnModelFolder);
@@ -183,6 +183,26 @@ void tinyProject::addSceneInstance(Asc::Handle fromHandle, Asc::Handle toHandle,
     }
 }
 
+bool tinyProject::saveScene(Asc::Handle sceneHandle, const std::string& path) {
+    const rtScene* scene = r().get<rtScene>(sceneHandle);
+    return scene && scene->save(path);
+}
+
+Asc::Handle tinyProject::loadScene(const std::string& path, Asc::Handle parentFolder) {
+    parentFolder = parentFolder ? parentFolder : fs_->rootHandle();
+
+    rtScene scene;
+    scene.init(sharedRes_);
+
+    // Loads under the fresh root, then the saved root takes its place
+    if (!scene.load(path)) return Asc::Handle();
+    scene.rootShift();
+
+    std::string name = scene.nName(scene.rootHandle());
+    Asc::Handle fnHandle = fs_->createFile(name.empty() ? "Scene" : name, std::move(scene), parentFolder);
+    return fs_->dataHandle(fnHandle);
+}
+
 // ------------------- Filesystem Setup -------------------
 
 void tinyProject::setupResources() {
@@ -0,0 +1,256 @@
+#include "tinyRT/rtBVH.hpp"
+
+#include <algorithm>
+
+using namespace tinyRT;
+
+// ---------------------------------------------------------------
+// Node storage
+// ---------------------------------------------------------------
+
+uint32_t BVH::allocNode() {
+    if (free_ == NONE) {
+        nodes_.emplace_back();
+        return static_cast<uint32_t>(nodes_.size() - 1);
+    }
+
+    uint32_t i = free_;
+    free_ = nodes_[i].child2;
+    nodes_[i] = Node();
+    return i;
+}
+
+void BVH::freeNode(uint32_t i) noexcept {
+    nodes_[i].owner = Asc::Handle();
+    nodes_[i].child1 = NONE;
+    nodes_[i].child2 = free_;
+    nodes_[i].height = -1;
+    free_ = i;
+}
+
+AABB BVH::fatten(const AABB& box) noexcept {
+    // Relative margin so a tree of pebbles and a tree of buildings behave alike
+    return box.grown((box.max - box.min) * 0.1f + glm::vec3(0.05f));
+}
+
+void BVH::clear() noexcept {
+    nodes_.clear();
+    root_ = NONE;
+    free_ = NONE;
+    leafCount_ = 0;
+}
+
+// ---------------------------------------------------------------
+// Proxies
+// ---------------------------------------------------------------
+
+uint32_t BVH::insert(Asc::Handle owner, const AABB& box, uint32_t tags) {
+    uint32_t leaf = allocNode();
+
+    Node& n = nodes_[leaf];
+    n.owner = owner;
+    n.tags = tags;
+    n.tight = box;
+    n.box = fatten(box);
+    n.height = 0;
+
+    insertLeaf(leaf);
+    ++leafCount_;
+    return leaf;
+}
+
+void BVH::remove(uint32_t proxy) noexcept {
+    if (proxy >= nodes_.size() || !nodes_[proxy].leaf() || nodes_[proxy].height < 0) return;
+
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --leafCount_;
+}
+
+bool BVH::refit(uint32_t proxy, const AABB& box) {
+    Node& n = nodes_[proxy];
+
+    // Stretch the new fat box along the motion so steady movers stay put for a few frames
+    const glm::vec3 step = (box.center() - n.tight.center()) * 2.0f;
+    AABB fat = fatten(box);
+    fat.min += glm::min(step, glm::vec3(0.0f));
+    fat.max += glm::max(step, glm::vec3(0.0f));
+
+    n.tight = box;
+
+    // Still inside the old fat box, and that one isn't wildly oversized (it shrank a lot)
+    if (n.box.contains(box)) {
+        AABB huge = fat.grown((fat.max - fat.min) * 0.4f + glm::vec3(0.2f));
+        if (huge.contains(n.box)) return false;
+    }
+
+    removeLeaf(proxy);
+    nodes_[proxy].box = fat;
+    insertLeaf(proxy);
+    return true;
+}
+
+void BVH::setTags(uint32_t proxy, uint32_t tags) noexcept {
+    if (proxy >= nodes_.size() || nodes_[proxy].tags == tags) return;
+    nodes_[proxy].tags = tags;
+
+    // Up until an ancestor's union comes out the same
+    for (uint32_t index = nodes_[proxy].parent; index != NONE; index = nodes_[index].parent) {
+        Node& n = nodes_[index];
+        uint32_t merged = nodes_[n.child1].tags | nodes_[n.child2].tags;
+        if (n.tags == merged) break;
+        n.tags = merged;
+    }
+}
+
+// ---------------------------------------------------------------
+// Tree surgery
+// ---------------------------------------------------------------
+
+void BVH::insertLeaf(uint32_t leaf) {
+    if (root_ == NONE) {
+        root_ = leaf;
+        nodes_[leaf].parent = NONE;
+        return;
+    }
+
+    // Descend toward the cheapest sibling (surface area heuristic)
+    const AABB leafBox = nodes_[leaf].box;
+    uint32_t index = root_;
+
+    while (!nodes_[index].leaf()) {
+        const Node& n = nodes_[index];
+
+        float area = n.box.area();
+        float combined = n.box.merged(leafBox).area();
+
+        float cost = 2.0f * combined;                 // New parent here
+        float inherit = 2.0f * (combined - area);     // Pushing down grows every ancestor
+
+        auto descendCost = [&](uint32_t c) {
+            const Node& cn = nodes_[c];
+            float merged = cn.box.merged(leafBox).area();
+            return (cn.leaf() ? merged : merged - cn.box.area()) + inherit;
+        };
+
+        float cost1 = descendCost(n.child1);
+        float cost2 = descendCost(n.child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = cost1 < cost2 ? n.child1 : n.child2;
+    }
+
+    const uint32_t sibling = index;
+
+    // New parent takes the sibling's spot
+    const uint32_t oldParent = nodes_[sibling].parent;
+    const uint32_t newParent = allocNode(); // May reallocate, no Node& across this
+
+    nodes_[newParent].parent = oldParent;
+    nodes_[newParent].box = leafBox.merged(nodes_[sibling].box);
+    nodes_[newParent].tags = nodes_[leaf].tags | nodes_[sibling].tags;
+    nodes_[newParent].height = nodes_[sibling].height + 1;
+    nodes_[newParent].child1 = sibling;
+    nodes_[newParent].child2 = leaf;
+    nodes_[sibling].parent = newParent;
+    nodes_[leaf].parent = newParent;
+
+    if (oldParent == NONE) root_ = newParent;
+    else if (nodes_[oldParent].child1 == sibling) nodes_[oldParent].child1 = newParent;
+    else nodes_[oldParent].child2 = newParent;
+
+    // Walk back up fixing boxes and heights
+    for (index = nodes_[leaf].parent; index != NONE; index = nodes_[index].parent) {
+        index = balance(index);
+
+        Node& n = nodes_[index];
+        n.height = 1 + std::max(nodes_[n.child1].height, nodes_[n.child2].height);
+        n.box = nodes_[n.child1].box.merged(nodes_[n.child2].box);
+        n.tags = nodes_[n.child1].tags | nodes_[n.child2].tags;
+    }
+}
+
+void BVH::removeLeaf(uint32_t leaf) noexcept {
+    if (leaf == root_) {
+        root_ = NONE;
+        return;
+    }
+
+    const uint32_t parent = nodes_[leaf].parent;
+    const uint32_t grand = nodes_[parent].parent;
+    const uint32_t sibling = nodes_[parent].child1 == leaf ? nodes_[parent].child2 : nodes_[parent].child1;
+
+    // Sibling takes the parent's spot
+    nodes_[sibling].parent = grand;
+    freeNode(parent);
+
+    if (grand == NONE) {
+        root_ = sibling;
+        return;
+    }
+
+    if (nodes_[grand].child1 == parent) nodes_[grand].child1 = sibling;
+    else nodes_[grand].child2 = sibling;
+
+    for (uint32_t index = grand; index != NONE; index = nodes_[index].parent) {
+        index = balance(index);
+
+        Node& n = nodes_[index];
+        n.height = 1 + std::max(nodes_[n.child1].height, nodes_[n.child2].height);
+        n.box = nodes_[n.child1].box.merged(nodes_[n.child2].box);
+        n.tags = nodes_[n.child1].tags | nodes_[n.child2].tags;
+    }
+}
+
+// Rotate the taller grandchild up if A is out of balance, returns the subtree's new root
+uint32_t BVH::balance(uint32_t iA) noexcept {
+    Node& A = nodes_[iA];
+    if (A.leaf() || A.height < 2) return iA;
+
+    const uint32_t iB = A.child1;
+    const uint32_t iC = A.child2;
+    Node& B = nodes_[iB];
+    Node& C = nodes_[iC];
+
+    const int32_t lean = C.height - B.height;
+
+    // Lift one side's child (iUp) above A. iUp's taller child stays, the shorter one goes to A
+    auto rotate = [&](uint32_t iUp, Node& Up, Node& Other, bool upWasChild2) {
+        const uint32_t iF = Up.child1;
+        const uint32_t iG = Up.child2;
+        Node& F = nodes_[iF];
+        Node& G = nodes_[iG];
+
+        // Up replaces A under A's parent
+        Up.child1 = iA;
+        Up.parent = A.parent;
+        A.parent = iUp;
+
+        if (Up.parent == NONE) root_ = iUp;
+        else if (nodes_[Up.parent].child1 == iA) nodes_[Up.parent].child1 = iUp;
+        else nodes_[Up.parent].child2 = iUp;
+
+        const bool keepF = F.height > G.height;
+        const uint32_t iKeep = keepF ? iF : iG;
+        const uint32_t iGive = keepF ? iG : iF;
+        Node& Give = nodes_[iGive];
+
+        Up.child2 = iKeep;
+        if (upWasChild2) A.child2 = iGive;
+        else A.child1 = iGive;
+        Give.parent = iA;
+
+        A.box = Other.box.merged(Give.box);
+        A.tags = Other.tags | Give.tags;
+        A.height = 1 + std::max(Other.height, Give.height);
+
+        Up.box = A.box.merged(nodes_[iKeep].box);
+        Up.tags = A.tags | nodes_[iKeep].tags;
+        Up.height = 1 + std::max(A.height, nodes_[iKeep].height);
+        return iUp;
+    };
+
+    if (lean > 1) return rotate(iC, C, B, true);
+    if (lean < -1) return rotate(iB, B, C, false);
+    return iA;
+}
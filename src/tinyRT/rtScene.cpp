@@ -3,6 +3,8 @@
 // Others
 #include "tinyScript/tinyScript.hpp"
 
+#include <algorithm>
+
 using namespace tinyRT;
 
 void Scene::init(const SceneRes& res) noexcept {
@@ -10,9 +12,14 @@ void Scene::init(const SceneRes& res) noexcept {
 
     // Create root node
     Node rootNode;
-    rootNode.name = "Root";
+    rootNode.nameID = Asc::Name::intern("Root");
 
     root_ = nodes_.emplace(std::move(rootNode));
+    indexName(root_);
+
+    // Transform pass only visits what changed, see updateWorlds()
+    rt_.view<rtTRANFM3D>().trackChanges();
+    rt_.view<rtMESHRD3D>().trackChanges(); // Same for the bounds refit, see updateBounds()
 }
 
 // ---------------------------------------------------------------
@@ -21,47 +28,157 @@ void Scene::init(const SceneRes& res) noexcept {
 
 #include <stdexcept>
 
-std::string& Scene::nName(Asc::Handle nHandle) noexcept {
+const std::string& Scene::nName(Asc::Handle nHandle) const noexcept {
+    const Node* node = nodes_.get(nHandle);
+    return Asc::Name::str(node ? node->nameID : Asc::Name::EMPTY);
+}
+
+void Scene::nRename(Asc::Handle nHandle, std::string name) noexcept {
+    Node* node = nodes_.get(nHandle);
+    if (!node) return;
+
+    Asc::Name::ID nameID = Asc::Name::intern(name);
+    if (nameID == node->nameID) return;
+
+    // Name tags (eg. "Debug") are baked into the flat hierarchy, plain renames leave it be
+    static const Asc::Name::ID debugID = Asc::Name::intern("Debug");
+    if (nameID == debugID || node->nameID == debugID) flatDirty_ = true;
+
+    unindexName(nHandle);
+    node->nameID = nameID;
+    indexName(nHandle);
+    touch();
+}
+
+void Scene::indexName(Asc::Handle nHandle) noexcept {
+    Node* node = nodes_.get(nHandle);
+    if (!node) return;
+
+    std::vector<Asc::Handle>& bucket = byName_[node->nameID];
+    node->nameSlot = static_cast<uint32_t>(bucket.size());
+    bucket.push_back(nHandle);
+}
+
+void Scene::unindexName(Asc::Handle nHandle) noexcept {
     Node* node = nodes_.get(nHandle);
-    return node->name;
+    if (!node) return;
+
+    auto it = byName_.find(node->nameID);
+    if (it == byName_.end()) return;
+
+    // Swap-remove, the moved node learns its new slot
+    std::vector<Asc::Handle>& bucket = it->second;
+    Asc::Handle last = bucket.back();
+    bucket[node->nameSlot] = last;
+    nodes_.get(last)->nameSlot = node->nameSlot;
+    bucket.pop_back();
+
+    if (bucket.empty()) byName_.erase(it);
+}
+
+Asc::Handle Scene::nFind(Asc::Name::ID nameID) const noexcept {
+    auto it = byName_.find(nameID);
+    return it != byName_.end() ? it->second.front() : Asc::Handle();
+}
+
+Asc::Span<const Asc::Handle> Scene::nFindAll(Asc::Name::ID nameID) const noexcept {
+    auto it = byName_.find(nameID);
+    return it != byName_.end() ? Asc::Span<const Asc::Handle>(it->second) : Asc::Span<const Asc::Handle>();
+}
+
+void Scene::linkChild(Asc::Handle parent, Asc::Handle child) noexcept {
+    Node* p = nodes_.get(parent);
+    Node* c = nodes_.get(child);
+    if (!p || !c) return;
+
+    c->parent = parent;
+    c->prevSibling = p->lastChild;
+    c->nextSibling = Asc::Handle();
+
+    if (Node* last = nodes_.get(p->lastChild)) last->nextSibling = child;
+    else p->firstChild = child;
+
+    p->lastChild = child;
+    ++p->childCount;
+}
+
+void Scene::unlinkChild(Asc::Handle child) noexcept {
+    Node* c = nodes_.get(child);
+    if (!c) return;
+
+    if (Node* p = nodes_.get(c->parent)) {
+        if (p->firstChild == child) p->firstChild = c->nextSibling;
+        if (p->lastChild == child) p->lastChild = c->prevSibling;
+        --p->childCount;
+    }
+
+    if (Node* prev = nodes_.get(c->prevSibling)) prev->nextSibling = c->nextSibling;
+    if (Node* next = nodes_.get(c->nextSibling)) next->prevSibling = c->prevSibling;
+
+    c->parent.invalidate();
+    c->prevSibling.invalidate();
+    c->nextSibling.invalidate();
 }
 
 bool Scene::rootShift() noexcept {
     // Shift the root to the child if root only has one child
     Node* rootNode = nodes_.get(root_);
-    if (!rootNode || rootNode->children.size() != 1) return false;
+    if (!rootNode || rootNode->childCount != 1) return false;
+
+    // Grab the child before erasing, the erase invalidates rootNode
+    Asc::Handle newRoot = rootNode->firstChild;
 
     nErase(root_, false);
-    root_ = rootNode->children[0];
+    root_ = newRoot;
     return true;
 }
 
-std::vector<Asc::Handle> Scene::nQueue(Asc::Handle start) noexcept {
+std::vector<Asc::Handle> Scene::nQueue(Asc::Handle start) const noexcept {
     std::vector<Asc::Handle> queue; // A DFS queue
+    if (!nodes_.get(start)) return queue;
 
-    std::function<void(Asc::Handle)> addToQueue = [&](Asc::Handle h) {
-        Node* node = nodes_.get(h);
-        if (!node) return;
+    // Pre-order off the sibling links. The stack holds where to resume once a subtree is done,
+    // so every node is fetched exactly once (start's own siblings are not ours)
+    std::vector<Asc::Handle> resume;
 
+    Asc::Handle h = start;
+    while (true) {
         queue.push_back(h);
-
-        for (Asc::Handle child : node->children) addToQueue(child);
-    };
-    addToQueue(start);
+        const Node* node = nodes_.get(h);
+        Asc::Handle next = h != start ? node->nextSibling : Asc::Handle();
+
+        if (node->firstChild) {
+            if (next) resume.push_back(next);
+            h = node->firstChild;
+        } else if (next) {
+            h = next;
+        } else if (!resume.empty()) {
+            h = resume.back();
+            resume.pop_back();
+        } else break;
+    }
     return queue;
 }
 
+std::vector<Asc::Handle> Scene::nChildren(Asc::Handle nHandle) const noexcept {
+    std::vector<Asc::Handle> children;
+    if (const Node* node = nodes_.get(nHandle)) children.reserve(node->childCount);
+
+    nForEachChild(nHandle, [&](Asc::Handle c) { children.push_back(c); });
+    return children;
+}
+
 Asc::Handle Scene::nAdd(const std::string& name, Asc::Handle parent) noexcept {
     parent = parent ? parent : root_;
-    Node* nParent = nodes_.get(parent);
-    if (!nParent) return Asc::Handle();
+    if (!nodes_.get(parent)) return Asc::Handle();
 
     Node newNode;
-    newNode.name = name;
-    newNode.parent = parent;
+    newNode.nameID = Asc::Name::intern(name);
 
     Asc::Handle nHandle = nodes_.emplace(std::move(newNode));
-    nodes_.get(parent)->addChild(nHandle);
+    linkChild(parent, nHandle);
+    indexName(nHandle);
+    dirtyHierarchy();
 
     return nHandle;
 }
@@ -71,19 +188,19 @@ void Scene::nErase(Asc::Handle nHandle, bool recursive, size_t* count) noexcept
     if (!node) return;
 
     Asc::Handle parentHandle = node->parent;
-    Node* parentNode = nodes_.get(parentHandle);
-    if (parentNode) parentNode->rmChild(nHandle);
+    unlinkChild(nHandle);
+
+    dirtyHierarchy();
 
     if (!recursive) {
         nEraseAllComps(nHandle);
+        unindexName(nHandle);
 
-        // Reparent children to rescue parent
-        for (Asc::Handle childHandle : node->children) {
-            if (Node* childNode = nodes_.get(childHandle)) {
-                childNode->parent = parentHandle;
-
-                if (parentNode) parentNode->addChild(childHandle);
-            }
+        // Reparent children to rescue parent (or make them orphans if there is none)
+        std::vector<Asc::Handle> children = nChildren(nHandle);
+        for (Asc::Handle childHandle : children) {
+            unlinkChild(childHandle);
+            linkChild(parentHandle, childHandle);
         }
 
         nodes_.erase(nHandle);
@@ -91,24 +208,21 @@ void Scene::nErase(Asc::Handle nHandle, bool recursive, size_t* count) noexcept
         return;
     }
 
-    size_t count_ = 0;
-    std::function<void(Asc::Handle)> eraseRec = [&](Asc::Handle h) {
-        Node* n = nodes_.get(h);
-        if (!n) return;
-
-        std::vector<Asc::Handle> childrenCopy = n->children;
+    // Gather the whole subtree first, then every pool gets a single batch
+    std::vector<Asc::Handle> subtree = nQueue(nHandle);
 
-        nEraseAllComps(h);
-        nodes_.erase(h);
-        count_++;
+    std::vector<Asc::Handle> comps;
+    for (Asc::Handle h : subtree) {
+        nodes_.get(h)->forEachComp([&](Asc::Handle rtHandle) { comps.push_back(rtHandle); });
+        unindexName(h);
+        dropBounds(h);
+        dropDraw(h);
+    }
 
-        for (Asc::Handle childHandle : childrenCopy) {
-            eraseRec(childHandle);
-        }
-    };
-    eraseRec(nHandle);
+    rt_.erase(comps);
+    nodes_.erase(subtree);
 
-    if (count) (*count) = count_;
+    if (count) (*count) = subtree.size();
 }
 
 Asc::Handle Scene::nReparent(Asc::Handle nHandle, Asc::Handle nNewParent) noexcept {
@@ -128,14 +242,10 @@ Asc::Handle Scene::nReparent(Asc::Handle nHandle, Asc::Handle nNewParent) noexce
         checkHandle = checkNode->parent;
     }
 
-    // Remove from current parent
-    if (Node* currentParentNode = nodes_.get(node->parent)) {
-        currentParentNode->rmChild(nHandle);
-    }
-
-    // Set new parent
-    node->parent = nNewParent;
-    newParent->addChild(nHandle);
+    // Move to the back of the new parent's list
+    unlinkChild(nHandle);
+    linkChild(nNewParent, nHandle);
+    dirtyHierarchy();
 
     return nHandle;
 }
@@ -145,182 +255,600 @@ void Scene::nEraseAllComps(Asc::Handle nHandle) noexcept {
     Node* node = nodes_.get(nHandle);
     if (!node) return;
 
-    for (auto& [_, rtHandle] : node->comps) {
-        rt_.erase(rtHandle);
+    if (node->has<rtTRANFM3D>()) worldsDirty_ = true;
+    if (node->has<rtMESHRD3D>()) { dropBounds(nHandle); dropDraw(nHandle); }
+
+    node->forEachComp([&](Asc::Handle rtHandle) { rt_.erase(rtHandle); });
+
+    node->compMask = 0;
+    for (Asc::Handle& h : node->comps) h.invalidate();
+    touch();
+}
+
+// ---------------------------------------------------------------
+// Deferred edits
+// ---------------------------------------------------------------
+
+Asc::Handle SceneCmds::nAdd(const std::string& name, Asc::Handle parent) {
+    Asc::Handle p = pending();
+    push([p, name, parent](Scene& scene, Asc::CmdQueue<Scene>& q) {
+        q.bind(p, scene.nAdd(name, q.resolve(parent)));
+    });
+    return p;
+}
+
+void SceneCmds::nErase(Asc::Handle nHandle, bool recursive) {
+    push([nHandle, recursive](Scene& scene, Asc::CmdQueue<Scene>& q) {
+        scene.nErase(q.resolve(nHandle), recursive);
+    });
+}
+
+void SceneCmds::nReparent(Asc::Handle nHandle, Asc::Handle nNewParent) {
+    push([nHandle, nNewParent](Scene& scene, Asc::CmdQueue<Scene>& q) {
+        scene.nReparent(q.resolve(nHandle), q.resolve(nNewParent));
+    });
+}
+
+size_t Scene::flush() noexcept {
+    return cmds_->flush(*this);
+}
+
+// ---------------------------------------------------------------
+// Special scene methods
+// ---------------------------------------------------------------
+
+// Order a component pool by its owner's DFS rank, unowned/orphaned go last
+template<typename T>
+static void cleansePool(Asc::Reg& rt, const std::vector<uint32_t>& rank) {
+    Asc::Pool<T>& pool = rt.view<T>();
+
+    auto rankOf = [&](uint32_t densePos) -> uint32_t {
+        Asc::Handle owner = pool.ownerAt(densePos);
+        return owner && owner.index < rank.size() ? rank[owner.index] : UINT32_MAX;
+    };
+
+    std::vector<uint32_t> order(pool.count());
+    for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return rankOf(a) < rankOf(b);
+    });
+
+    pool.permute(order);
+}
+
+void Scene::cleanse() noexcept {
+    if (clean_) return;
+
+    std::vector<Asc::Handle> queue = nQueue(root_);
+
+    // Node handle index -> DFS rank
+    std::vector<uint32_t> rank;
+    std::vector<uint32_t> order;
+    std::vector<bool> placed(nodes_.count(), false);
+    order.reserve(nodes_.count());
+
+    for (uint32_t i = 0; i < queue.size(); ++i) {
+        Asc::Handle h = queue[i];
+        if (h.index >= rank.size()) rank.resize(h.index + 1, UINT32_MAX);
+        rank[h.index] = i;
+
+        uint32_t pos = nodes_.posOf(h);
+        order.push_back(pos);
+        placed[pos] = true;
+    }
+
+    // Unreachable nodes (shouldn't exist, but) keep their relative order at the back
+    for (uint32_t pos = 0; pos < nodes_.count(); ++pos) {
+        if (!placed[pos]) order.push_back(pos);
     }
 
-    node->comps.clear();
+    nodes_.permute(order);
+
+    cleansePool<rtTRANFM3D>(rt_, rank);
+    cleansePool<rtMESHRD3D>(rt_, rank);
+    cleansePool<rtSKELE3D>(rt_, rank);
+    cleansePool<rtSCRIPT>(rt_, rank);
+
+    clean_ = true;
 }
 
 // ---------------------------------------------------------------
 // Scene stuff and things idk
 // ---------------------------------------------------------------
 
-void Scene::update(FrameStart frameStart) noexcept {
-    float dt = frameStart.deltaTime;
-    uint32_t frame = frameStart.frameIndex;
+void Scene::rebuildFlat() noexcept {
+    flat_.nodes = nQueue(root_);
+
+    const uint32_t n = static_cast<uint32_t>(flat_.nodes.size());
+    flat_.parents.assign(n, UINT32_MAX);
+    flat_.ends.resize(n);
+    flat_.worlds.resize(n);
+    flat_.debugs.clear();
+    flat_.index.assign(flat_.index.size(), UINT32_MAX);
+
+    // Handle index -> flat index, parents are always seen first
+    std::vector<uint32_t>& flatIdx = flat_.index;
+    for (uint32_t i = 0; i < n; ++i) {
+        Asc::Handle h = flat_.nodes[i];
+        if (h.index >= flatIdx.size()) flatIdx.resize(h.index + 1, UINT32_MAX);
+        flatIdx[h.index] = i;
+
+        const Node* node = nodes_.get(h);
+        if (i > 0 && node->parent && node->parent.index < flatIdx.size()) {
+            flat_.parents[i] = flatIdx[node->parent.index];
+        }
+    }
 
-    // Testing ground
-    testRenders.clear();
+    // "Debug" tagged nodes straight from the name index, in DFS order
+    static const Asc::Name::ID debugID = Asc::Name::intern("Debug");
+    for (Asc::Handle h : nFindAll(debugID)) {
+        uint32_t i = h.index < flatIdx.size() ? flatIdx[h.index] : UINT32_MAX;
+        if (i != UINT32_MAX && flat_.nodes[i] == h) flat_.debugs.push_back(i);
+    }
+    std::sort(flat_.debugs.begin(), flat_.debugs.end());
 
-    const tinyCamera& cam = camera();
-    tinyDrawable& draw = drawable();
+    // Subtree ends, children sit after their parent so one backward sweep does it
+    for (uint32_t i = 0; i < n; ++i) flat_.ends[i] = i + 1;
+    for (uint32_t i = n; i-- > 1;) {
+        uint32_t p = flat_.parents[i];
+        if (p != UINT32_MAX && flat_.ends[p] < flat_.ends[i]) flat_.ends[p] = flat_.ends[i];
+    }
 
-    draw.startFrame(frame);
+    flatDirty_ = false;
+    worldsDirty_ = true; // Entries moved around, the cached worlds mean nothing now
+}
 
-    std::function<void(Asc::Handle, glm::mat4)> updateNode = [&](Asc::Handle nHandle, glm::mat4 parentMat) {
-        Node* node = nodes_.get(nHandle);
-        if (!node) return;
+void Scene::updateWorlds(uint32_t begin, uint32_t end) noexcept {
+    const Asc::Handle* flatNodes = flat_.nodes.data();
+    const uint32_t* flatParents = flat_.parents.data();
+    glm::mat4* flatWorlds = flat_.worlds.data();
 
-        glm::mat4 currentWorld = parentMat;
+    // Parent of `begin` is outside the range and already settled, everything else is inside
+    for (uint32_t i = begin; i < end; ++i) {
+        const uint32_t p = flatParents[i];
+        const glm::mat4 parentWorld = p != UINT32_MAX ? flatWorlds[p] : glm::mat4(1.0f);
 
-        // 1. Transform (must be first to compute currentWorld)
-        if (node->has<rtTRANFM3D>()) {
-            rtTRANFM3D* tranfm3D = rt_.get<rtTRANFM3D>(node->get<rtTRANFM3D>());
-            // Scale restriction: local cannot have 0 scale on any axis
-            for (int i = 0; i < 3; ++i) {
-                if (glm::length(glm::vec3(tranfm3D->local[i])) < 1e-6f) {
-                    tranfm3D->local[i][i] = 1e-6f * (tranfm3D->local[i][i] < 0.0f ? -1.0f : 1.0f);
-                }
-            }
+        rtTRANFM3D* tranfm3D = rt_.getFor<rtTRANFM3D>(flatNodes[i]);
+        if (!tranfm3D) {
+            flatWorlds[i] = parentWorld;
+            continue;
+        }
 
-            tranfm3D->world = parentMat * tranfm3D->local;
-            currentWorld = currentWorld * tranfm3D->local;
+        // Scale restriction lives in setScl(), local() is always sane
+        tranfm3D->world = parentWorld * tranfm3D->local();
+        flatWorlds[i] = tranfm3D->world;
+    }
+}
 
-            // Debug rotation
-            if (node->name == "Debug") {
-                tranfm3D->local = glm::rotate(tranfm3D->local, dt, glm::vec3(0.0f, 1.0f, 0.0f));
-            }
+void Scene::splitWorldRoots() noexcept {
+#ifdef _OPENMP
+    const size_t target = static_cast<size_t>(omp_get_max_threads()) * 4;
+#else
+    const size_t target = 1;
+#endif
+    constexpr uint32_t minSplit = 1024; // Not worth a task below this
+
+    // Settle the head of the biggest subtree here, its children become roots of their own
+    while (dirtyRoots_.size() < target) {
+        size_t best = 0;
+        for (size_t k = 1; k < dirtyRoots_.size(); ++k) {
+            uint32_t a = dirtyRoots_[k], b = dirtyRoots_[best];
+            if (flat_.ends[a] - a > flat_.ends[b] - b) best = k;
         }
 
-        // 2. Skeleton
-        if (node->has<rtSKELE3D>()) {
-            rtSKELE3D* skel3D = rt_.get<rtSKELE3D>(node->get<rtSKELE3D>());
-            skel3D->update();
+        const uint32_t r = dirtyRoots_[best];
+        const uint32_t end = flat_.ends[r];
+        if (end - r < minSplit) break;
+
+        updateWorlds(r, r + 1);
+
+        dirtyRoots_[best] = dirtyRoots_.back();
+        dirtyRoots_.pop_back();
+        for (uint32_t c = r + 1; c < end; c = flat_.ends[c]) dirtyRoots_.push_back(c);
+    }
+}
+
+void Scene::updateWorlds() noexcept {
+    const uint32_t n = static_cast<uint32_t>(flat_.nodes.size());
+    Asc::Pool<rtTRANFM3D>& tranfms = rt_.view<rtTRANFM3D>();
+
+    // Close the window first, anything stamped from here on (Debug spin, scripts) is next pass's problem
+    const uint32_t since = tranfmSeen_;
+    tranfmSeen_ = tranfms.tick();
+    tranfms.nextTick();
+
+    dirtyRoots_.clear();
+
+    if (worldsDirty_ || !tranfms.tracksChanges()) {
+        // Every top-level subtree
+        for (uint32_t i = 0; i < n; i = flat_.ends[i]) dirtyRoots_.push_back(i);
+        worldsDirty_ = false;
+    } else {
+        // Stamped locals -> flat entries
+        const rtTRANFM3D* base = tranfms.data();
+        tranfms.forEachChangedSince(since, [&](rtTRANFM3D& tranfm3D, uint32_t) {
+            Asc::Handle owner = tranfms.ownerAt(static_cast<uint32_t>(&tranfm3D - base));
+            if (owner.index >= flat_.index.size()) return;
+
+            uint32_t i = flat_.index[owner.index];
+            if (i != UINT32_MAX && flat_.nodes[i] == owner) dirtyRoots_.push_back(i);
+        });
+
+        // Keep the outermost of each dirty subtree, anything inside rides along
+        std::sort(dirtyRoots_.begin(), dirtyRoots_.end());
+
+        size_t kept = 0;
+        uint32_t covered = 0;
+        for (uint32_t i : dirtyRoots_) {
+            if (i < covered) continue;
+            covered = flat_.ends[i];
+            dirtyRoots_[kept++] = i;
         }
+        dirtyRoots_.resize(kept);
+    }
 
-        // 3. Script
-        if (node->has<rtSCRIPT>()) {
-            rtSCRIPT* scriptComp = rt_.get<rtSCRIPT>(node->get<rtSCRIPT>());
-            Asc::Handle scriptHandle = scriptComp->scriptHandle;
+    movedRoots_ = dirtyRoots_;
+    if (dirtyRoots_.empty()) return;
 
-            if (tinyScript* scriptDef = fsr().get<tinyScript>(scriptHandle)) {
-                if (scriptDef->version() != scriptComp->cacheVersion) {
-                    scriptDef->initVars(scriptComp->vars);
-                    scriptDef->initLocals(scriptComp->locals);
-                    scriptComp->cacheVersion = scriptDef->version();
-                }
-                scriptDef->update(scriptComp, this, nHandle, dt);
-            }
+    splitWorldRoots();
+
+    // Roots are disjoint subtrees whose parents are already settled
+    Asc::parallelFor(static_cast<uint32_t>(dirtyRoots_.size()), 1, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t k = begin; k < end; ++k) {
+            uint32_t r = dirtyRoots_[k];
+            updateWorlds(r, flat_.ends[r]);
         }
+    });
+}
 
-        // 4. Mesh Render (last, uses final currentWorld)
-        if (node->has<rtMESHRD3D>()) {
-            rtMESHRD3D* meshRD3D = rt_.get<rtMESHRD3D>(node->get<rtMESHRD3D>());
-            const tinyMesh* mesh = fsr().get<tinyMesh>(meshRD3D->meshHandle());
+void Scene::syncBounds(Asc::Handle nHandle, const rtMESHRD3D& meshRD3D, const glm::mat4& world) {
+    if (nHandle.index >= bvhProxy_.size()) bvhProxy_.resize(nHandle.index + 1, BVH::NONE);
+    uint32_t& proxy = bvhProxy_[nHandle.index];
+    if (proxy != BVH::NONE && bvh_.owner(proxy) != nHandle) proxy = BVH::NONE; // Stale slot from a recycled index
+
+    const tinyMesh* mesh = fsr().get<tinyMesh>(meshRD3D.meshHandle());
+    if (!mesh) {
+        if (proxy != BVH::NONE) bvh_.remove(proxy);
+        proxy = BVH::NONE;
+        return;
+    }
+
+    AABB box = AABB::transform(mesh->ABmin(), mesh->ABmax(), world);
+    if (proxy == BVH::NONE) proxy = bvh_.insert(nHandle, box, BoundsDynamic);
+    else bvh_.refit(proxy, box);
+}
 
-            if (mesh && cam.collideAABB(mesh->ABmin(), mesh->ABmax(), currentWorld)) {
-                const Skeleton3D* skele3D = this->nGetComp<Skeleton3D>(meshRD3D->skeleNodeHandle());
+void Scene::dropBounds(Asc::Handle nHandle) noexcept {
+    if (nHandle.index >= bvhProxy_.size()) return;
 
-                for (uint32_t subIdx = 0; subIdx < mesh->submeshes().size(); ++subIdx) {
-                    const tinyMesh::Submesh* submesh = mesh->submesh(subIdx);
+    uint32_t& proxy = bvhProxy_[nHandle.index];
+    if (proxy != BVH::NONE && bvh_.owner(proxy) == nHandle) bvh_.remove(proxy);
+    proxy = BVH::NONE;
+}
 
-                    // Submesh culling
-                    if (!cam.collideAABB(submesh->ABmin, submesh->ABmax, currentWorld)) continue;
+void Scene::syncDraw(Asc::Handle nHandle, const rtMESHRD3D& meshRD3D, const glm::mat4& world) {
+    if (nHandle.index >= drawItems_.size()) drawItems_.resize(nHandle.index + 1);
+    DrawItem& slot = drawItems_[nHandle.index];
 
-                    const std::vector<glm::mat4>* skinData = skele3D ? &skele3D->skinData() : nullptr;
-                    const rtMESHRD3D::SubMorph* subMorph = meshRD3D->subMrph(subIdx);
+    if (slot.node != nHandle) { // Recycled index
+        if (slot.item) drawList_.remove(slot.item);
+        slot = { nHandle, Asc::Handle() };
+    }
 
-                    tinyDrawable::Entry entry;
-                    entry.mesh = meshRD3D->meshHandle();
-                    entry.submesh = subIdx;
-                    entry.model = currentWorld;
+    bool retain = meshRD3D.isStatic() && !meshRD3D.skeleNodeHandle() && meshRD3D.cMrphWeights().empty() &&
+                  fsr().get<tinyMesh>(meshRD3D.meshHandle());
 
-                    if (skinData) {
-                        entry.skeleData.skeleNode = meshRD3D->skeleNodeHandle();
-                        entry.skeleData.skinData = skinData;
-                    }
+    if (slot.item && (!retain || drawList_.mesh(slot.item) != meshRD3D.meshHandle())) {
+        drawList_.remove(slot.item);
+        slot.item = Asc::Handle();
+    }
 
-                    if (!meshRD3D->mrphWeights().empty()) {
-                        entry.morphData.node = nHandle;
-                        entry.morphData.weights = &meshRD3D->mrphWeights();
-                    }
+    if (retain) {
+        if (slot.item) drawList_.move(slot.item, world);
+        else slot.item = drawList_.add(meshRD3D.meshHandle(), world);
+    }
 
-                    draw.submit(entry);
-                }
+    uint32_t proxy = nHandle.index < bvhProxy_.size() ? bvhProxy_[nHandle.index] : BVH::NONE;
+    if (proxy != BVH::NONE && bvh_.owner(proxy) == nHandle) bvh_.setTags(proxy, retain ? BoundsRetained : BoundsDynamic);
+}
+
+void Scene::dropDraw(Asc::Handle nHandle) noexcept {
+    if (nHandle.index >= drawItems_.size()) return;
+
+    DrawItem& slot = drawItems_[nHandle.index];
+    if (slot.node != nHandle) return;
+
+    if (slot.item) drawList_.remove(slot.item);
+    slot = DrawItem();
+}
+
+void Scene::updateBounds() noexcept {
+    Asc::Pool<rtMESHRD3D>& meshRDs = rt_.view<rtMESHRD3D>();
+
+    const uint32_t since = meshSeen_;
+    meshSeen_ = meshRDs.tick();
+    meshRDs.nextTick();
+
+    // Meshes under a moved subtree. Tree surgery is serial, the walk is what the world pass already paid
+    for (uint32_t r : movedRoots_) {
+        for (uint32_t i = r; i < flat_.ends[r]; ++i) {
+            if (const rtMESHRD3D* meshRD3D = rt_.getFor<rtMESHRD3D>(flat_.nodes[i])) {
+                syncBounds(flat_.nodes[i], *meshRD3D, flat_.worlds[i]);
+                syncDraw(flat_.nodes[i], *meshRD3D, flat_.worlds[i]);
             }
         }
+    }
+    movedRoots_.clear();
+
+    // New meshes and mesh swaps that didn't move
+    meshRDs.forEachChangedSince(since, [&](rtMESHRD3D& meshRD3D, uint32_t) {
+        Asc::Handle owner = meshRDs.ownerAt(static_cast<uint32_t>(&meshRD3D - meshRDs.data()));
+        if (owner.index >= flat_.index.size()) return;
+
+        uint32_t i = flat_.index[owner.index];
+        if (i == UINT32_MAX || flat_.nodes[i] != owner) return;
 
-        // Recurse into children
-        for (Asc::Handle childHandle : node->children) {
-            updateNode(childHandle, currentWorld);
+        syncBounds(owner, meshRD3D, flat_.worlds[i]);
+        syncDraw(owner, meshRD3D, flat_.worlds[i]);
+    });
+}
+
+void Scene::updateSkeletons() noexcept {
+    // Palettes only read their own pose data
+    rt_.view<rtSKELE3D>().parallelForEach([](rtSKELE3D& skel3D, uint32_t) {
+        skel3D.update();
+    }, 1);
+}
+
+void Scene::updateScripts(float dt) noexcept {
+    Asc::Pool<rtSCRIPT>& scripts = rt_.view<rtSCRIPT>();
+
+    // Pool order (DFS after cleanse()). Scripts added along the way wait for the next frame
+    const uint32_t n = scripts.count();
+    for (uint32_t i = 0; i < n && i < scripts.count(); ++i) {
+        rtSCRIPT* scriptComp = scripts.data() + i; // Re-fetched every step, a script may grow the pool
+        Asc::Handle nHandle = scripts.ownerAt(i);
+
+        tinyScript* scriptDef = fsr().get<tinyScript>(scriptComp->scriptHandle);
+        if (!scriptDef) continue;
+
+        if (scriptDef->version() != scriptComp->cacheVersion) {
+            scriptDef->initVars(scriptComp->vars);
+            scriptDef->initLocals(scriptComp->locals);
+            scriptComp->cacheVersion = scriptDef->version();
         }
-    };
-    updateNode(root_, glm::mat4(1.0f));
 
-    draw.finalize();
+        // Structural edits from scripts go through cmds(), the flat arrays stay put
+        scriptDef->update(scriptComp, this, nHandle, dt);
+    }
 }
 
+void Scene::extractDraws() noexcept {
+    Asc::Pool<rtMESHRD3D>& meshRDs = rt_.view<rtMESHRD3D>();
+    const tinyCamera& cam = camera();
 
-Asc::Handle Scene::instantiate(Asc::Handle sceneHandle, Asc::Handle parent) noexcept {
-    const Scene* fromScene = fsr().get<Scene>(sceneHandle);
-    if (!fromScene) return Asc::Handle();
+    // Mesh-level cull on the BVH, only what's in view gets touched below. Static meshes are the list's,
+    // it culls them per group (mesh x cell) in submit()
+    // Back to pool order so batches don't depend on the tree's shape
+    visible_.clear();
+    bvh_.queryFrustum(cam.planes, [&](Asc::Handle owner) {
+        uint32_t pos = meshRDs.posFor(owner);
+        if (pos != UINT32_MAX) visible_.push_back(pos);
+    }, BoundsDynamic);
+    std::sort(visible_.begin(), visible_.end());
+
+    // Contiguous chunks of pool order, at most 64 of them, each submits into its own bucket
+    const uint32_t count = static_cast<uint32_t>(visible_.size());
+    const uint32_t grain = std::max(64u, (count + 63) / 64);
+    const uint32_t chunks = (count + grain - 1) / grain;
 
-    Asc::Handle newRootHandle;
+    tinyDrawable& draw = drawable();
+    draw.openBuckets(chunks);
 
-    Node* parentNode = nodes_.get(parent);
-    if (!parentNode) parent = root_;
+    // Extraction is read-only, buckets merge in chunk order so the batches don't depend on the thread count
+    Asc::parallelFor(count, grain, [&](uint32_t begin, uint32_t end) {
+        tinyDrawable::Bucket& out = draw.bucket(begin / grain);
 
-    UnorderedMap<Asc::Handle, Asc::Handle> from_to;
-    auto getToHandle = [&](Asc::Handle fromHandle) -> Asc::Handle {
-        auto it = from_to.find(fromHandle);
-        return it != from_to.end() ? it->second : Asc::Handle();
-    };
+        for (uint32_t k = begin; k < end; ++k) {
+            const uint32_t i = visible_[k];
+            const rtMESHRD3D* meshRD3D = meshRDs.data() + i;
+            Asc::Handle nHandle = meshRDs.ownerAt(i);
 
-    std::function<void(Asc::Handle, Asc::Handle)> cloneRec = [&](Asc::Handle fromHandle, Asc::Handle toParent) {
-        const Node* fromNode = fromScene->node(fromHandle);
-        if (!fromNode) return;
+            // World from the transform pass, scripts may have pulled the node since
+            uint32_t f = nHandle.index < flat_.index.size() ? flat_.index[nHandle.index] : UINT32_MAX;
+            if (f == UINT32_MAX || flat_.nodes[f] != nHandle) continue;
 
-        Asc::Handle toHandle = nAdd(fromNode->name, toParent);
-        Node* toNode = nodes_.get(toHandle);
-        from_to[fromHandle] = toHandle;
+            const glm::mat4& currentWorld = flat_.worlds[f];
+            const tinyMesh* mesh = fsr().get<tinyMesh>(meshRD3D->meshHandle());
+            if (!mesh) continue;
 
-        // Find new root
-        if (fromHandle == fromScene->rootHandle()) newRootHandle = toHandle;
+            const Skeleton3D* skele3D = this->nGetComp<Skeleton3D>(meshRD3D->skeleNodeHandle());
+            const std::vector<glm::mat4>* skinData = skele3D ? &skele3D->skinData() : nullptr;
 
-        // Establish parent-child relationship
-        toNode->parent = toParent;
-        if (Node* toParentNode = node(toParent)) toParentNode->addChild(toHandle);
+            for (uint32_t subIdx = 0; subIdx < mesh->submeshes().size(); ++subIdx) {
+                const tinyMesh::Submesh* submesh = mesh->submesh(subIdx);
 
-        // Clone components
-        if (const rtTRANFM3D* fromTrans = fromScene->nGetComp<rtTRANFM3D>(fromHandle)) {
-            rtTRANFM3D* toTrans = nWriteComp<rtTRANFM3D>(toHandle);
-            toTrans->local = fromTrans->local;
-        }
+                // Submesh culling
+                if (!cam.collideAABB(submesh->ABmin, submesh->ABmax, currentWorld)) continue;
 
-        if (const rtMESHRD3D* fromMeshRD = fromScene->nGetComp<rtMESHRD3D>(fromHandle)) {
-            rtMESHRD3D* toMeshRD = nWriteComp<rtMESHRD3D>(toHandle);
-            toMeshRD->copy(fromMeshRD).
-                assignSkeleNode(getToHandle(fromMeshRD->skeleNodeHandle()));
-        }
+                tinyDrawable::Entry entry;
+                entry.mesh = meshRD3D->meshHandle();
+                entry.submesh = subIdx;
+                entry.model = currentWorld;
+
+                if (skinData) {
+                    entry.skeleData.skeleNode = meshRD3D->skeleNodeHandle();
+                    entry.skeleData.skinData = skinData;
+                }
+
+                if (!meshRD3D->mrphWeights().empty()) {
+                    entry.morphData.node = nHandle;
+                    entry.morphData.weights = &meshRD3D->mrphWeights();
+                }
 
-        if (const rtSKELE3D* fromSkele3D = fromScene->nGetComp<rtSKELE3D>(fromHandle)) {
-            rtSKELE3D* toSkele3D = nWriteComp<rtSKELE3D>(toHandle);
-            toSkele3D->copy(fromSkele3D);
+                out.submit(entry);
+            }
         }
+    });
+
+    draw.submit(drawList_, &cam);
+}
+
+void Scene::update(FrameStart frameStart) noexcept {
+    float dt = frameStart.deltaTime;
+    uint32_t frame = frameStart.frameIndex;
+
+    // Testing ground
+    testRenders.clear();
+
+    drawable().startFrame(frame);
+
+    // New change tick for every component pool, incremental systems compare against their last seen tick
+    rt_.nextTick();
+
+    // Anything recorded between frames lands before the phases
+    flush();
 
-        if (const rtSCRIPT* fromScript = fromScene->nGetComp<rtSCRIPT>(fromHandle)) {
-            rtSCRIPT* toScript = nWriteComp<rtSCRIPT>(toHandle);
-            *toScript = *fromScript; // Lightweight, can copy directly
+    if (flatDirty_) rebuildFlat();
+
+    // 1. Transforms, only the subtrees under a changed local
+    updateWorlds();
+
+    // 1b. Mesh bounds, BVH refit for whatever just moved
+    updateBounds();
+
+    // 2. Skeleton palettes
+    updateSkeletons();
+
+    // Debug rotation (lands next frame, same as before)
+    for (uint32_t i : flat_.debugs) {
+        if (rtTRANFM3D* tranfm3D = nPatchComp<rtTRANFM3D>(flat_.nodes[i])) {
+            tranfm3D->setRot(tranfm3D->rot() * glm::angleAxis(dt, glm::vec3(0.0f, 1.0f, 0.0f)));
         }
+    }
+
+    // 3. Scripts, serial (Lua state is single threaded)
+    updateScripts(dt);
+
+    // 4. Culling and draw extraction
+    extractDraws();
 
-        // Recurse into children
-        for (Asc::Handle fromChildHandle : fromNode->children) {
-            cloneRec(fromChildHandle, toHandle);
+    drawable().finalize();
+
+    // Sync point, the phases are done and the drawable already copied what it needed
+    flush();
+}
+
+const Scene::Prefab& Scene::prefab() const noexcept {
+    if (!prefab_) prefab_ = std::make_unique<Prefab>();
+    Prefab& pf = *prefab_;
+    if (pf.revision == revision_) return pf;
+
+    pf.srcNodes = nQueue(root_);
+    const std::vector<Asc::Handle>& queue = pf.srcNodes;
+    const uint32_t n = static_cast<uint32_t>(queue.size());
+
+    pf.entryOf.clear();
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t idx = queue[i].index;
+        if (idx >= pf.entryOf.size()) pf.entryOf.resize(idx + 1, Prefab::NONE);
+        pf.entryOf[idx] = i;
+    }
+
+    pf.nodes.resize(n);
+    for (Prefab::Comps& c : pf.comps) { c.owners.clear(); c.src.clear(); }
+
+    for (uint32_t i = 0; i < n; ++i) {
+        const Node* node = nodes_.get(queue[i]);
+
+        Prefab::Entry& e = pf.nodes[i];
+        e.name = node->nameID;
+        e.parent = pf.entry(node->parent);
+        e.firstChild = pf.entry(node->firstChild);
+        e.lastChild = pf.entry(node->lastChild);
+        e.prevSibling = i ? pf.entry(node->prevSibling) : Prefab::NONE; // The root's siblings aren't ours
+        e.nextSibling = i ? pf.entry(node->nextSibling) : Prefab::NONE;
+        e.childCount = node->childCount;
+
+        for (uint32_t slot = 0; slot < Node::COMP_SLOTS; ++slot) {
+            if (!(node->compMask & (1u << slot))) continue;
+            pf.comps[slot].owners.push_back(i);
+            pf.comps[slot].src.push_back(node->comps[slot]);
         }
-    };
+    }
+
+    pf.revision = revision_;
+    return pf;
+}
+
+template<typename T, typename F>
+void Scene::cloneComps(const Scene& from, const Prefab& pf, const std::vector<Asc::Handle>& toNodes, F&& copy) noexcept {
+    const Prefab::Comps& c = pf.comps[Node::slot<T>()];
+    if (c.owners.empty()) return;
+
+    std::vector<Asc::Handle> owners(c.owners.size());
+    for (uint32_t k = 0; k < owners.size(); ++k) owners[k] = toNodes[c.owners[k]];
+
+    std::vector<Asc::Handle> made(owners.size());
+    rt_.emplaceForN<T>(owners, made);
+
+    // Source fetched after the batch, from may be this very scene
+    const Asc::Pool<T>* fromPool = &from.rt_.view<T>();
+    for (uint32_t k = 0; k < made.size(); ++k) {
+        nodes_.get(owners[k])->add<T>(made[k]);
+        copy(*rt_.get<T>(made[k]), *fromPool->get(c.src[k]));
+    }
+}
+
+Asc::Handle Scene::instantiate(Asc::Handle sceneHandle, Asc::Handle parent) noexcept {
+    const Scene* fromScene = fsr().get<Scene>(sceneHandle);
+    if (!fromScene) return Asc::Handle();
+
+    if (!nodes_.get(parent)) parent = root_;
+
+    // Shape is precompiled, the clone is a batch allocation plus index -> handle fixups
+    const Prefab& pf = fromScene->prefab();
+    const uint32_t n = static_cast<uint32_t>(pf.nodes.size());
+    if (n == 0) return Asc::Handle();
+
+    std::vector<Asc::Handle> toNodes(n);
+    nodes_.emplaceN(Asc::Span<Asc::Handle>(toNodes));
+    dirtyHierarchy();
+
+    auto toHandle = [&](uint32_t i) { return i != Prefab::NONE ? toNodes[i] : Asc::Handle(); };
+
+    for (uint32_t i = 0; i < n; ++i) {
+        const Prefab::Entry& e = pf.nodes[i];
+        Node* toNode = nodes_.get(toNodes[i]);
+
+        toNode->nameID = e.name;
+        toNode->parent = toHandle(e.parent);
+        toNode->firstChild = toHandle(e.firstChild);
+        toNode->lastChild = toHandle(e.lastChild);
+        toNode->prevSibling = toHandle(e.prevSibling);
+        toNode->nextSibling = toHandle(e.nextSibling);
+        toNode->childCount = e.childCount;
+    }
+    linkChild(parent, toNodes[0]);
+    for (Asc::Handle h : toNodes) indexName(h);
+
+    // Components, one batch per pool
+    cloneComps<rtTRANFM3D>(*fromScene, pf, toNodes, [](rtTRANFM3D& to, const rtTRANFM3D& from) {
+        to = from;
+    });
+
+    cloneComps<rtMESHRD3D>(*fromScene, pf, toNodes, [&](rtMESHRD3D& to, const rtMESHRD3D& from) {
+        to.copy(&from).assignSkeleNode(toHandle(pf.entry(from.skeleNodeHandle())));
+    });
+
+    cloneComps<rtSKELE3D>(*fromScene, pf, toNodes, [](rtSKELE3D& to, const rtSKELE3D& from) {
+        to.copy(&from);
+    });
 
-    cloneRec(fromScene->rootHandle(), parent);
+    cloneComps<rtSCRIPT>(*fromScene, pf, toNodes, [](rtSCRIPT& to, const rtSCRIPT& from) {
+        to = from; // Lightweight, can copy directly
+    });
 
-    return newRootHandle;
+    return toNodes[0];
 }
\ No newline at end of file
@@ -0,0 +1,600 @@
+#include "tinyRT/rtScene.hpp"
+#include "tinyRT/rtSnapshot.hpp"
+
+// Others
+#include "tinyScript/tinyScript.hpp"
+#include "tinyTexture.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace tinyRT;
+namespace Snap = tinyRT::Snapshot;
+
+namespace {
+
+// ---------------------------------------------------------------
+// File access
+// ---------------------------------------------------------------
+
+// Whole file, read-only. Mapped when the OS allows it, plain read otherwise
+class FileView {
+public:
+    explicit FileView(const std::string& path) {
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) return;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) return;
+        size_ = static_cast<size_t>(size.QuadPart);
+
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_) data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            size_ = static_cast<size_t>(st.st_size);
+
+            void* map = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED) {
+                map_ = map;
+                data_ = static_cast<const uint8_t*>(map);
+                madvise(map, size_, MADV_WILLNEED);
+            }
+        }
+        close(fd);
+#endif
+        if (!data_ && size_) readAll(path);
+    }
+
+    ~FileView() {
+#ifdef _WIN32
+        if (data_ && fallback_.empty()) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+        if (map_) munmap(map_, size_);
+#endif
+    }
+
+    FileView(const FileView&) = delete;
+    FileView& operator=(const FileView&) = delete;
+
+    [[nodiscard]] const uint8_t* data() const noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return data_ ? size_ : 0; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<uint8_t> fallback_;
+
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    void* map_ = nullptr;
+#endif
+
+    void readAll(const std::string& path) {
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        if (!f) return;
+
+        fallback_.resize(size_);
+        if (std::fread(fallback_.data(), 1, size_, f) == size_) data_ = fallback_.data();
+        std::fclose(f);
+    }
+};
+
+// Section view with bounds checked once, records are then read in place
+template<typename T>
+bool section(const uint8_t* base, size_t size, const Snap::Header& hdr, Snap::Sec sec, Asc::Span<const T>& out) {
+    const Snap::Section& s = hdr.secs[sec];
+    if (s.count > UINT32_MAX || s.offset % alignof(T) || s.offset > size) return false;
+    if (s.count > (size - s.offset) / sizeof(T)) return false;
+
+    out = Asc::Span<const T>(reinterpret_cast<const T*>(base + s.offset), static_cast<uint32_t>(s.count));
+    return true;
+}
+
+// ---------------------------------------------------------------
+// Script vars, tagged by tinyVar alternative index
+// ---------------------------------------------------------------
+
+enum HandleKind : uint8_t { HandleNone, HandleNode, HandleRef };
+
+template<typename T> struct IsVector : std::false_type {};
+template<typename T> struct IsVector<std::vector<T>> : std::true_type {};
+
+struct VarWriter {
+    std::vector<uint8_t>& out;
+    std::function<std::pair<HandleKind, uint32_t>(Asc::Handle)> handle;
+
+    void bytes(const void* p, size_t n) {
+        const uint8_t* b = static_cast<const uint8_t*>(p);
+        out.insert(out.end(), b, b + n);
+    }
+
+    template<typename T>
+    void put(const T& v) {
+        if constexpr (std::is_same_v<T, bool>) {
+            uint8_t b = v ? 1 : 0;
+            bytes(&b, 1);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            uint32_t len = static_cast<uint32_t>(v.size());
+            bytes(&len, 4);
+            bytes(v.data(), len);
+        } else if constexpr (std::is_same_v<T, Asc::Handle>) {
+            auto [kind, index] = handle(v);
+            bytes(&kind, 1);
+            bytes(&index, 4);
+        } else if constexpr (IsVector<T>::value) {
+            uint32_t count = static_cast<uint32_t>(v.size());
+            bytes(&count, 4);
+            for (const auto& e : v) put(static_cast<typename T::value_type>(e)); // vector<bool> hands out proxies
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>);
+            bytes(&v, sizeof(T));
+        }
+    }
+};
+
+struct VarReader {
+    const uint8_t* p;
+    const uint8_t* end;
+    std::function<Asc::Handle(HandleKind, uint32_t)> handle;
+    bool ok = true;
+
+    bool bytes(void* dst, size_t n) {
+        if (!ok || size_t(end - p) < n) return ok = false;
+        std::memcpy(dst, p, n);
+        p += n;
+        return true;
+    }
+
+    template<typename T>
+    void get(T& v) {
+        if constexpr (std::is_same_v<T, bool>) {
+            uint8_t b = 0;
+            bytes(&b, 1);
+            v = b != 0;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            uint32_t len = 0;
+            if (!bytes(&len, 4) || size_t(end - p) < len) { ok = false; return; }
+            v.assign(reinterpret_cast<const char*>(p), len);
+            p += len;
+        } else if constexpr (std::is_same_v<T, Asc::Handle>) {
+            uint8_t kind = HandleNone;
+            uint32_t index = 0;
+            bytes(&kind, 1);
+            bytes(&index, 4);
+            v = ok ? handle(static_cast<HandleKind>(kind), index) : Asc::Handle();
+        } else if constexpr (IsVector<T>::value) {
+            uint32_t count = 0;
+            if (!bytes(&count, 4) || count > size_t(end - p)) { ok = false; return; } // Every element is at least a byte
+            v.resize(count);
+            for (uint32_t i = 0; i < count && ok; ++i) {
+                typename T::value_type e{};
+                get(e);
+                v[i] = e;
+            }
+        } else {
+            bytes(&v, sizeof(T));
+        }
+    }
+};
+
+template<size_t... I>
+bool emplaceVar(tinyVar& var, size_t index, std::index_sequence<I...>) {
+    return ((index == I ? (var.emplace<I>(), true) : false) || ...);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------
+// Save
+// ---------------------------------------------------------------
+
+bool Scene::save(const std::string& path) const {
+    const Prefab& pf = prefab();
+    const uint32_t n = static_cast<uint32_t>(pf.nodes.size());
+    if (n == 0) return false;
+
+    const Asc::Reg& fsr = *res_.fsr;
+
+    std::vector<Snap::Node>   nodes(n);
+    std::vector<Snap::Name>   names;
+    std::vector<char>         chars;
+    std::vector<Snap::Ref>    refs;
+    std::vector<Snap::Tranfm> tranfms;
+    std::vector<Snap::Mesh>   meshes;
+    std::vector<Snap::Skele>  skeles;
+    std::vector<Snap::Script> scripts;
+    std::vector<float>        floats;
+    std::vector<Snap::Mat4>   mats;
+    std::vector<uint8_t>      vars;
+
+    std::unordered_map<Asc::Name::ID, uint32_t> nameOf;
+    auto nameIdx = [&](Asc::Name::ID id) {
+        auto [it, fresh] = nameOf.emplace(id, static_cast<uint32_t>(names.size()));
+        if (fresh) {
+            const std::string& str = Asc::Name::str(id);
+            names.push_back({ static_cast<uint32_t>(chars.size()), static_cast<uint32_t>(str.size()) });
+            chars.insert(chars.end(), str.begin(), str.end());
+        }
+        return it->second;
+    };
+
+    // Resource handle -> ref slot, hashed once per resource
+    std::unordered_map<Asc::Handle, uint32_t> refOf;
+    auto refIdx = [&](Asc::Handle h) {
+        if (!h) return Snap::NONE;
+
+        auto it = refOf.find(h);
+        if (it != refOf.end()) return it->second;
+
+        Snap::Ref ref{ 0, Snap::RefType::Mesh };
+        if (const tinyMesh* mesh = fsr.get<tinyMesh>(h)) ref = { mesh->hash(), Snap::RefType::Mesh };
+        else if (const tinySkeleton* skele = fsr.get<tinySkeleton>(h)) ref = { skele->hash(), Snap::RefType::Skeleton };
+        else if (const tinyScript* script = fsr.get<tinyScript>(h)) ref = { script->hash(), Snap::RefType::Script };
+        else if (const tinyTexture* texture = fsr.get<tinyTexture>(h)) ref = { texture->hash(), Snap::RefType::Texture };
+
+        uint32_t slot = ref.hash ? static_cast<uint32_t>(refs.size()) : Snap::NONE;
+        if (ref.hash) refs.push_back(ref);
+
+        refOf.emplace(h, slot);
+        return slot;
+    };
+
+    for (uint32_t i = 0; i < n; ++i) {
+        nodes[i] = { nameIdx(pf.nodes[i].name), i ? pf.nodes[i].parent : Snap::NONE };
+    }
+
+    auto forEachComp = [&](auto* tag, auto&& f) {
+        using T = std::remove_pointer_t<decltype(tag)>;
+        const Prefab::Comps& c = pf.comps[Node::slot<T>()];
+        const Asc::Pool<T>& pool = rt_.view<T>();
+
+        for (size_t k = 0; k < c.owners.size(); ++k) {
+            if (const T* comp = pool.get(c.src[k])) f(c.owners[k], *comp);
+        }
+    };
+
+    forEachComp((rtTRANFM3D*)nullptr, [&](uint32_t node, const rtTRANFM3D& t) {
+        Snap::Tranfm& r = tranfms.emplace_back();
+        r.node = node;
+        for (int a = 0; a < 3; ++a) { r.pos[a] = t.pos()[a]; r.scl[a] = t.scl()[a]; }
+        r.rot[0] = t.rot().x; r.rot[1] = t.rot().y; r.rot[2] = t.rot().z; r.rot[3] = t.rot().w;
+    });
+
+    forEachComp((rtMESHRD3D*)nullptr, [&](uint32_t node, const rtMESHRD3D& m) {
+        Snap::Mesh& r = meshes.emplace_back();
+        r.node = node;
+        r.ref = refIdx(m.meshHandle());
+        r.skeleNode = pf.entry(m.skeleNodeHandle());
+        r.flags = m.isStatic() ? uint32_t(Snap::MeshStatic) : 0u;
+
+        const std::vector<float>& ws = m.cMrphWeights();
+        bool posed = std::any_of(ws.begin(), ws.end(), [](float w) { return w != 0.0f; });
+
+        r.weights = posed ? static_cast<uint32_t>(floats.size()) : 0;
+        r.weightCount = posed ? static_cast<uint32_t>(ws.size()) : 0;
+        if (posed) floats.insert(floats.end(), ws.begin(), ws.end());
+    });
+
+    forEachComp((rtSKELE3D*)nullptr, [&](uint32_t node, const rtSKELE3D& s) {
+        Snap::Skele& r = skeles.emplace_back();
+        r.node = node;
+        r.ref = refIdx(s.skeleHandle());
+
+        // Bind pose is what init() rebuilds anyway
+        const tinySkeleton* skeleton = s.rSkeleton();
+        const std::vector<glm::mat4>& local = s.localPoses();
+
+        bool posed = false;
+        for (size_t b = 0; skeleton && b < local.size() && b < skeleton->bones.size() && !posed; ++b) {
+            posed = local[b] != skeleton->bones[b].bindPose;
+        }
+
+        r.pose = posed ? static_cast<uint32_t>(mats.size()) : 0;
+        r.poseCount = posed ? static_cast<uint32_t>(local.size()) : 0;
+        for (size_t b = 0; posed && b < local.size(); ++b) {
+            std::memcpy(mats.emplace_back().m, &local[b][0][0], sizeof(Snap::Mat4));
+        }
+    });
+
+    // Handles in vars: nodes of this scene by entry, resources by ref, anything else is dropped
+    VarWriter vw{ vars, [&](Asc::Handle h) -> std::pair<HandleKind, uint32_t> {
+        uint32_t e = pf.entry(h);
+        if (e != Prefab::NONE) return { HandleNode, e };
+
+        uint32_t ref = refIdx(h);
+        if (ref != Snap::NONE) return { HandleRef, ref };
+        return { HandleNone, 0 };
+    } };
+
+    forEachComp((rtSCRIPT*)nullptr, [&](uint32_t node, const rtSCRIPT& s) {
+        Snap::Script& r = scripts.emplace_back();
+        r.node = node;
+        r.ref = refIdx(s.scriptHandle);
+        r.vars = static_cast<uint32_t>(vars.size());
+
+        // Key order, same scene saves to the same bytes
+        std::vector<const std::pair<const std::string, tinyVar>*> sorted;
+        for (const auto& kv : s.vars) sorted.push_back(&kv);
+        std::sort(sorted.begin(), sorted.end(), [](auto* a, auto* b) { return a->first < b->first; });
+
+        uint32_t count = static_cast<uint32_t>(sorted.size());
+        vw.put(count);
+        for (const auto* kv : sorted) {
+            vw.put(kv->first);
+            uint8_t tag = static_cast<uint8_t>(kv->second.index());
+            vw.put(tag);
+            std::visit([&](const auto& v) { vw.put(v); }, kv->second);
+        }
+
+        r.varsSize = static_cast<uint32_t>(vars.size()) - r.vars;
+    });
+
+    // Lay it out, header goes in last once the offsets are known
+    Snap::Header hdr;
+    std::vector<uint8_t> out(sizeof(Snap::Header));
+
+    auto put = [&](Snap::Sec sec, const auto& v) {
+        out.resize((out.size() + 7) & ~size_t(7), 0);
+        hdr.secs[sec] = { out.size(), v.size() };
+
+        const uint8_t* b = reinterpret_cast<const uint8_t*>(v.data());
+        out.insert(out.end(), b, b + v.size() * sizeof(v[0]));
+    };
+    put(Snap::SecNodes, nodes);
+    put(Snap::SecNames, names);
+    put(Snap::SecChars, chars);
+    put(Snap::SecRefs, refs);
+    put(Snap::SecTranfms, tranfms);
+    put(Snap::SecMeshes, meshes);
+    put(Snap::SecSkeles, skeles);
+    put(Snap::SecScripts, scripts);
+    put(Snap::SecFloats, floats);
+    put(Snap::SecMats, mats);
+    put(Snap::SecVars, vars);
+
+    hdr.size = out.size();
+    std::memcpy(out.data(), &hdr, sizeof(hdr));
+
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return false;
+
+    bool ok = std::fwrite(out.data(), 1, out.size(), f) == out.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+// ---------------------------------------------------------------
+// Load
+// ---------------------------------------------------------------
+
+Asc::Handle Scene::load(const std::string& path, Asc::Handle parent) {
+    FileView file(path);
+    const uint8_t* base = file.data();
+    const size_t size = file.size();
+    if (size < sizeof(Snap::Header)) return Asc::Handle();
+
+    Snap::Header hdr;
+    std::memcpy(&hdr, base, sizeof(hdr));
+    if (hdr.magic != Snap::MAGIC || hdr.version != Snap::VERSION || hdr.size != size) return Asc::Handle();
+
+    Asc::Span<const Snap::Node>   nodes;
+    Asc::Span<const Snap::Name>   names;
+    Asc::Span<const char>         chars;
+    Asc::Span<const Snap::Ref>    refs;
+    Asc::Span<const Snap::Tranfm> tranfms;
+    Asc::Span<const Snap::Mesh>   meshes;
+    Asc::Span<const Snap::Skele>  skeles;
+    Asc::Span<const Snap::Script> scripts;
+    Asc::Span<const float>        floats;
+    Asc::Span<const Snap::Mat4>   mats;
+    Asc::Span<const uint8_t>      vars;
+
+    if (!section(base, size, hdr, Snap::SecNodes, nodes) ||
+        !section(base, size, hdr, Snap::SecNames, names) ||
+        !section(base, size, hdr, Snap::SecChars, chars) ||
+        !section(base, size, hdr, Snap::SecRefs, refs) ||
+        !section(base, size, hdr, Snap::SecTranfms, tranfms) ||
+        !section(base, size, hdr, Snap::SecMeshes, meshes) ||
+        !section(base, size, hdr, Snap::SecSkeles, skeles) ||
+        !section(base, size, hdr, Snap::SecScripts, scripts) ||
+        !section(base, size, hdr, Snap::SecFloats, floats) ||
+        !section(base, size, hdr, Snap::SecMats, mats) ||
+        !section(base, size, hdr, Snap::SecVars, vars)) return Asc::Handle();
+
+    const uint32_t n = nodes.size();
+    if (n == 0) return Asc::Handle();
+
+    // Parents before children, nothing else can make a cycle
+    for (uint32_t i = 0; i < n; ++i) {
+        const Snap::Node& e = nodes[i];
+        if (e.name >= names.size() || (i ? e.parent >= i : e.parent != Snap::NONE)) return Asc::Handle();
+    }
+
+    // Unique names, interned once each
+    std::vector<Asc::Name::ID> nameIDs(names.size());
+    for (uint32_t i = 0; i < names.size(); ++i) {
+        const Snap::Name& nm = names[i];
+        bool fits = nm.offset <= chars.size() && nm.length <= chars.size() - nm.offset;
+        nameIDs[i] = fits ? Asc::Name::intern(std::string_view(chars.data() + nm.offset, nm.length)) : Asc::Name::EMPTY;
+    }
+
+    // Refs -> whatever the registry holds with the same content, one hash index per type in use
+    std::unordered_map<uint64_t, Asc::Handle> byHash[4];
+    bool indexed[4] = {};
+
+    auto indexPool = [&](auto* tag, std::unordered_map<uint64_t, Asc::Handle>& out) {
+        using T = std::remove_pointer_t<decltype(tag)>;
+        const Asc::Pool<T>& pool = fsr().view<T>();
+        for (uint32_t i = 0; i < pool.count(); ++i) out.emplace(pool.data()[i].hash(), pool.handleAt(i));
+    };
+
+    std::vector<Asc::Handle> resolved(refs.size());
+    for (uint32_t i = 0; i < refs.size(); ++i) {
+        uint32_t t = static_cast<uint32_t>(refs[i].type);
+        if (t >= 4) continue;
+
+        if (!indexed[t]) {
+            switch (refs[i].type) {
+                case Snap::RefType::Mesh:     indexPool((tinyMesh*)nullptr, byHash[t]); break;
+                case Snap::RefType::Skeleton: indexPool((tinySkeleton*)nullptr, byHash[t]); break;
+                case Snap::RefType::Script:   indexPool((tinyScript*)nullptr, byHash[t]); break;
+                case Snap::RefType::Texture:  indexPool((tinyTexture*)nullptr, byHash[t]); break;
+            }
+            indexed[t] = true;
+        }
+
+        auto it = byHash[t].find(refs[i].hash);
+        if (it != byHash[t].end()) resolved[i] = it->second;
+    }
+    auto refHandle = [&](uint32_t ref) { return ref < resolved.size() ? resolved[ref] : Asc::Handle(); };
+
+    if (!nodes_.get(parent)) parent = root_;
+
+    // One batch allocation like instantiate(), entry order is sibling order
+    std::vector<Asc::Handle> toNodes(n);
+    nodes_.emplaceN(Asc::Span<Asc::Handle>(toNodes));
+    dirtyHierarchy();
+
+    for (uint32_t i = 0; i < n; ++i) {
+        nodes_.get(toNodes[i])->nameID = nameIDs[nodes[i].name];
+        linkChild(i ? toNodes[nodes[i].parent] : parent, toNodes[i]);
+        indexName(toNodes[i]);
+    }
+
+    // Components, one batch per pool. Records pointing outside the snapshot are skipped
+    std::vector<Asc::Handle> owners, made;
+    std::vector<uint32_t> from;
+
+    auto batch = [&](auto* tag, const auto& recs, auto&& fill) {
+        using T = std::remove_pointer_t<decltype(tag)>;
+
+        owners.clear();
+        from.clear();
+        for (uint32_t k = 0; k < recs.size(); ++k) {
+            if (recs[k].node >= n) continue;
+            owners.push_back(toNodes[recs[k].node]);
+            from.push_back(k);
+        }
+
+        made.assign(owners.size(), Asc::Handle());
+        rt_.emplaceForN<T>(owners, made);
+
+        for (uint32_t k = 0; k < made.size(); ++k) {
+            if (!made[k]) continue; // Duplicate record for the same node
+            nodes_.get(owners[k])->add<T>(made[k]);
+            fill(*rt_.get<T>(made[k]), recs[from[k]]);
+        }
+    };
+
+    batch((rtTRANFM3D*)nullptr, tranfms, [](rtTRANFM3D& to, const Snap::Tranfm& r) {
+        glm::vec3 pos(r.pos[0], r.pos[1], r.pos[2]);
+        glm::quat rot(r.rot[3], r.rot[0], r.rot[1], r.rot[2]);
+        glm::vec3 scl(r.scl[0], r.scl[1], r.scl[2]);
+
+        // Saved values are already normalized/clamped, the setters would only nudge the last bits
+        bool valid = glm::abs(glm::dot(rot, rot) - 1.0f) < 1e-5f && glm::all(glm::greaterThanEqual(glm::abs(scl), glm::vec3(1e-6f)));
+        if (valid) to.restore(pos, rot, scl);
+        else       to.setPos(pos).setRot(rot).setScl(scl);
+    });
+
+    // Untouched components share the first one's arrays, same as instantiate()
+    std::unordered_map<uint32_t, const rtMESHRD3D*> meshShared;
+    batch((rtMESHRD3D*)nullptr, meshes, [&](rtMESHRD3D& to, const Snap::Mesh& r) {
+        Asc::Handle skeleNode = r.skeleNode < n ? toNodes[r.skeleNode] : Asc::Handle();
+        bool isStatic = r.flags & Snap::MeshStatic;
+        bool posed = r.weightCount && r.weights <= floats.size() && r.weightCount <= floats.size() - r.weights;
+
+        auto shared = meshShared.find(r.ref);
+        if (!posed && shared != meshShared.end()) {
+            to.copy(shared->second).assignSkeleNode(skeleNode).setStatic(isStatic);
+            return;
+        }
+
+        Asc::Handle meshHandle = refHandle(r.ref);
+        to.assignMesh(meshHandle, fsr().get<tinyMesh>(meshHandle)).assignSkeleNode(skeleNode).setStatic(isStatic);
+
+        if (!posed) {
+            meshShared.emplace(r.ref, &to);
+            return;
+        }
+
+        std::vector<float>& ws = to.mrphWeights();
+        std::copy_n(floats.data() + r.weights, std::min<size_t>(ws.size(), r.weightCount), ws.begin());
+    });
+
+    std::unordered_map<uint32_t, const rtSKELE3D*> skeleShared;
+    batch((rtSKELE3D*)nullptr, skeles, [&](rtSKELE3D& to, const Snap::Skele& r) {
+        bool posed = r.poseCount && r.pose <= mats.size() && r.poseCount <= mats.size() - r.pose;
+
+        auto shared = skeleShared.find(r.ref);
+        if (!posed && shared != skeleShared.end()) {
+            to.copy(shared->second);
+            return;
+        }
+
+        to.init(&fsr().view<tinySkeleton>(), refHandle(r.ref));
+
+        if (!posed) {
+            skeleShared.emplace(r.ref, &to);
+            return;
+        }
+
+        uint32_t bones = std::min<uint32_t>(r.poseCount, static_cast<uint32_t>(to.localPoses().size()));
+        for (uint32_t b = 0; b < bones; ++b) {
+            std::memcpy(&to.localPose(b)[0][0], mats[r.pose + b].m, sizeof(Snap::Mat4));
+        }
+        to.update();
+    });
+
+    batch((rtSCRIPT*)nullptr, scripts, [&](rtSCRIPT& to, const Snap::Script& r) {
+        to.scriptHandle = refHandle(r.ref);
+        to.cacheVersion = 0; // Vars get merged with the script's defaults on its first update
+
+        if (r.vars > vars.size() || r.varsSize > vars.size() - r.vars) return;
+
+        VarReader vr{ vars.data() + r.vars, vars.data() + r.vars + r.varsSize, [&](HandleKind kind, uint32_t index) {
+            if (kind == HandleNode) return index < n ? toNodes[index] : Asc::Handle();
+            if (kind == HandleRef) return refHandle(index);
+            return Asc::Handle();
+        } };
+
+        uint32_t count = 0;
+        vr.get(count);
+        for (uint32_t i = 0; i < count && vr.ok; ++i) {
+            std::string key;
+            uint8_t tag = 0;
+            vr.get(key);
+            vr.get(tag);
+
+            tinyVar var;
+            if (!vr.ok || !emplaceVar(var, tag, std::make_index_sequence<std::variant_size_v<tinyVar>>())) break;
+
+            std::visit([&](auto& v) { vr.get(v); }, var);
+            if (vr.ok) to.vars[std::move(key)] = std::move(var);
+        }
+    });
+
+    return toNodes[0];
+}
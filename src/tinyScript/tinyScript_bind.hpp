@@ -322,6 +322,102 @@ static inline int scene_node(lua_State* L) {
     return 1;
 }
 
+// Scene:find(name) - Any node with that name, nil if none (O(1), no tree walk)
+static inline int scene_find(lua_State* L) {
+    rtScene** scenePtr = getSceneFromUserdata(L, 1);
+    if (!scenePtr || !*scenePtr)
+        return luaL_error(L, "Invalid scene");
+
+    const char* name = luaL_checkstring(L, 2);
+
+    Asc::Handle found = (*scenePtr)->nFind(name);
+    if (!found) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    pushNode(L, found);
+    return 1;
+}
+
+// Pushes a table of nodes, copy the handles out first (pushing may run GC)
+static inline void pushNodeList(lua_State* L, const std::vector<Asc::Handle>& found) {
+    lua_newtable(L);
+    for (int i = 0; i < found.size(); i++) {
+        pushNode(L, found[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+}
+
+// Scene:findAll(name) - Every node with that name, empty table if none
+static inline int scene_findAll(lua_State* L) {
+    rtScene** scenePtr = getSceneFromUserdata(L, 1);
+    if (!scenePtr || !*scenePtr)
+        return luaL_error(L, "Invalid scene");
+
+    const char* name = luaL_checkstring(L, 2);
+
+    // Copy out first, pushing may run Lua code (GC) that edits the scene
+    Asc::Span<const Asc::Handle> span = (*scenePtr)->nFindAll(name);
+    std::vector<Asc::Handle> found(span.begin(), span.end());
+
+    pushNodeList(L, found);
+    return 1;
+}
+
+// Scene:queryRadius(center, radius) - Every mesh node whose world bounds touch the sphere
+static inline int scene_queryRadius(lua_State* L) {
+    rtScene** scenePtr = getSceneFromUserdata(L, 1);
+    if (!scenePtr || !*scenePtr)
+        return luaL_error(L, "Invalid scene");
+
+    glm::vec3 center = *getVec3(L, 2);
+    float radius = static_cast<float>(luaL_checknumber(L, 3));
+
+    std::vector<Asc::Handle> found;
+    (*scenePtr)->bvh().querySphere(center, radius, [&](Asc::Handle h) { found.push_back(h); });
+
+    pushNodeList(L, found);
+    return 1;
+}
+
+// Scene:queryBox(min, max) - Every mesh node whose world bounds overlap the box
+static inline int scene_queryBox(lua_State* L) {
+    rtScene** scenePtr = getSceneFromUserdata(L, 1);
+    if (!scenePtr || !*scenePtr)
+        return luaL_error(L, "Invalid scene");
+
+    rtAABB box(*getVec3(L, 2), *getVec3(L, 3));
+
+    std::vector<Asc::Handle> found;
+    (*scenePtr)->bvh().queryBox(box, [&](Asc::Handle h) { found.push_back(h); });
+
+    pushNodeList(L, found);
+    return 1;
+}
+
+// Scene:raycast(origin, dir, maxDist?) - Closest mesh node hit and its distance, nil if none
+static inline int scene_raycast(lua_State* L) {
+    rtScene** scenePtr = getSceneFromUserdata(L, 1);
+    if (!scenePtr || !*scenePtr)
+        return luaL_error(L, "Invalid scene");
+
+    glm::vec3 origin = *getVec3(L, 2);
+    glm::vec3 dir = *getVec3(L, 3);
+    float maxDist = static_cast<float>(luaL_optnumber(L, 4, FLT_MAX));
+
+    float dist = 0.0f;
+    Asc::Handle hit = (*scenePtr)->bvh().raycast(origin, dir, maxDist, &dist);
+    if (!hit) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    pushNode(L, hit);
+    lua_pushnumber(L, dist);
+    return 2;
+}
+
 // ========================================
 // INPUT SYSTEM
 // ========================================
@@ -400,10 +496,7 @@ static inline int transform3d_getPos(lua_State* L) {
 
     auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
     if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        pushVec3(L, pos);
+        pushVec3(L, trfm3D->pos());
         return 1;
     }
     return 0;
@@ -416,69 +509,25 @@ static inline int transform3d_setPos(lua_State* L) {
     glm::vec3* newPos = getVec3(L, 2);
     if (!newPos) return luaL_error(L, "setPos expects Vec3");
     
-    auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
-    if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        trfm3D->local = composeMatrix(*newPos, rot, scale);
-    }
+    auto trfm3D = getSceneFromLua(L)->nPatchComp<rtTransform3D>(*handle);
+    if (trfm3D) trfm3D->setPos(*newPos);
     return 0;
 }
 
-static inline int transform3d_rotX(lua_State* L) {
+static inline int transform3d_rotAxis(lua_State* L, const glm::vec3& axis) {
     Asc::Handle* handle = getTransform3DHandle(L, 1);
     if (!handle) return 0;
     
     float degrees = luaL_checknumber(L, 2);
     
-    auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
-    if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        
-        glm::quat rotX = glm::angleAxis(glm::radians(degrees), glm::vec3(1.0f, 0.0f, 0.0f));
-        trfm3D->local = composeMatrix(pos, rotX * rot, scale);
-    }
+    auto trfm3D = getSceneFromLua(L)->nPatchComp<rtTransform3D>(*handle);
+    if (trfm3D) trfm3D->rotate(glm::angleAxis(glm::radians(degrees), axis));
     return 0;
 }
 
-static inline int transform3d_rotY(lua_State* L) {
-    Asc::Handle* handle = getTransform3DHandle(L, 1);
-    if (!handle) return 0;
-    
-    float degrees = luaL_checknumber(L, 2);
-    
-    auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
-    if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        
-        glm::quat rotY = glm::angleAxis(glm::radians(degrees), glm::vec3(0.0f, 1.0f, 0.0f));
-        trfm3D->local = composeMatrix(pos, rotY * rot, scale);
-    }
-    return 0;
-}
-
-static inline int transform3d_rotZ(lua_State* L) {
-    Asc::Handle* handle = getTransform3DHandle(L, 1);
-    if (!handle) return 0;
-    
-    float degrees = luaL_checknumber(L, 2);
-    
-    auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
-    if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        
-        glm::quat rotZ = glm::angleAxis(glm::radians(degrees), glm::vec3(0.0f, 0.0f, 1.0f));
-        trfm3D->local = composeMatrix(pos, rotZ * rot, scale);
-    }
-    return 0;
-}
+static inline int transform3d_rotX(lua_State* L) { return transform3d_rotAxis(L, glm::vec3(1.0f, 0.0f, 0.0f)); }
+static inline int transform3d_rotY(lua_State* L) { return transform3d_rotAxis(L, glm::vec3(0.0f, 1.0f, 0.0f)); }
+static inline int transform3d_rotZ(lua_State* L) { return transform3d_rotAxis(L, glm::vec3(0.0f, 0.0f, 1.0f)); }
 
 static inline int transform3d_getQuat(lua_State* L) {
     Asc::Handle* handle = getTransform3DHandle(L, 1);
@@ -486,9 +535,7 @@ static inline int transform3d_getQuat(lua_State* L) {
     
     auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
     if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
+        const glm::quat& rot = trfm3D->rot();
         pushVec4(L, glm::vec4(rot.x, rot.y, rot.z, rot.w));
         return 1;
     }
@@ -502,14 +549,8 @@ static inline int transform3d_setQuat(lua_State* L) {
     glm::vec4* quatVec = getVec4(L, 2);
     if (!quatVec) return luaL_error(L, "setQuat expects Vec4");
     
-    auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
-    if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        glm::quat quat(quatVec->w, quatVec->x, quatVec->y, quatVec->z);
-        trfm3D->local = composeMatrix(pos, quat, scale);
-    }
+    auto trfm3D = getSceneFromLua(L)->nPatchComp<rtTransform3D>(*handle);
+    if (trfm3D) trfm3D->setRot(glm::quat(quatVec->w, quatVec->x, quatVec->y, quatVec->z));
     return 0;
 }
 
@@ -519,10 +560,7 @@ static inline int transform3d_getScl(lua_State* L) {
     
     auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
     if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        pushVec3(L, scale);
+        pushVec3(L, trfm3D->scl());
         return 1;
     }
     return 0;
@@ -535,13 +573,8 @@ static inline int transform3d_setScl(lua_State* L) {
     glm::vec3* newScale = getVec3(L, 2);
     if (!newScale) return luaL_error(L, "setScl expects Vec3");
     
-    auto trfm3D = getSceneFromLua(L)->nGetComp<rtTransform3D>(*handle);
-    if (trfm3D) {
-        glm::vec3 pos, scale;
-        glm::quat rot;
-        decomposeMatrix(trfm3D->local, pos, rot, scale);
-        trfm3D->local = composeMatrix(pos, rot, *newScale);
-    }
+    auto trfm3D = getSceneFromLua(L)->nPatchComp<rtTransform3D>(*handle);
+    if (trfm3D) trfm3D->setScl(*newScale);
     return 0;
 }
 
@@ -598,7 +631,7 @@ static inline int bone_getLocalPos(lua_State* L) {
     
     glm::vec3 pos, scale;
     glm::quat rot;
-    decomposeMatrix(skel3D->localPose(bone->boneIndex), pos, rot, scale);
+    decomposeMatrix(skel3D->cLocalPose(bone->boneIndex), pos, rot, scale);
     
     pushVec3(L, pos);
     return 1;
@@ -699,7 +732,7 @@ static inline int bone_getLocalQuat(lua_State* L) {
     
     glm::vec3 pos, scale;
     glm::quat rot;
-    decomposeMatrix(skel3D->localPose(bone->boneIndex), pos, rot, scale);
+    decomposeMatrix(skel3D->cLocalPose(bone->boneIndex), pos, rot, scale);
     
     pushVec4(L, glm::vec4(rot.x, rot.y, rot.z, rot.w));
     return 1;
@@ -738,7 +771,7 @@ static inline int bone_getLocalScl(lua_State* L) {
     
     glm::vec3 pos, scale;
     glm::quat rot;
-    decomposeMatrix(skel3D->localPose(bone->boneIndex), pos, rot, scale);
+    decomposeMatrix(skel3D->cLocalPose(bone->boneIndex), pos, rot, scale);
     
     pushVec3(L, scale);
     return 1;
@@ -777,7 +810,7 @@ static inline int bone_localPose(lua_State* L) {
     
     glm::vec3 pos, scale;
     glm::quat rot;
-    decomposeMatrix(skel3D->localPose(bone->boneIndex), pos, rot, scale);
+    decomposeMatrix(skel3D->cLocalPose(bone->boneIndex), pos, rot, scale);
     
     lua_newtable(L);
     
@@ -1631,7 +1664,7 @@ static inline int node_children(lua_State* L) {
         return 1;
     }
 
-    std::vector<Asc::Handle> children = node->children;
+    std::vector<Asc::Handle> children = getSceneFromLua(L)->nChildren(*handle);
     lua_newtable(L);
     for (int i = 0; i < children.size(); i++) {
         pushNode(L, children[i]);
@@ -1664,7 +1697,7 @@ static inline int node_childrenHandles(lua_State* L) {
         return 1;
     }
 
-    std::vector<Asc::Handle> children = node->children;
+    std::vector<Asc::Handle> children = getSceneFromLua(L)->nChildren(*handle);
     
     // Create Array:handle() with metatable
     lua_newtable(L);
@@ -1680,7 +1713,7 @@ static inline int node_childrenHandles(lua_State* L) {
     return 1;
 }
 
-// node:delete([recursive]) - Delete this node
+// node:delete([recursive]) - Delete this node (queued, applied once the scene update finishes)
 static inline int node_delete(lua_State* L) {
     Asc::Handle* handle = getNodeHandleFromUserdata(L, 1);
     if (!handle) {
@@ -1694,14 +1727,14 @@ static inline int node_delete(lua_State* L) {
         recursive = lua_toboolean(L, 2);
     }
     
-    // Get scene and call removeNode
+    // Get scene and queue the removal, we're in the middle of Scene::update
     rtScene* scene = getSceneFromLua(L);
     if (!scene) {
         lua_pushboolean(L, false);
         return 1;
     }
     
-    scene->nErase(*handle, recursive);
+    scene->cmds().nErase(*handle, recursive);
     lua_pushboolean(L, true);
     return 1;
 }
@@ -2581,6 +2614,11 @@ static inline void registerNodeBindings(lua_State* L) {
     // Scene metatable
     LUA_BEGIN_METATABLE("Scene");
     LUA_REG_METHOD(scene_node, "node");
+    LUA_REG_METHOD(scene_find, "find");
+    LUA_REG_METHOD(scene_findAll, "findAll");
+    LUA_REG_METHOD(scene_queryRadius, "queryRadius");
+    LUA_REG_METHOD(scene_queryBox, "queryBox");
+    LUA_REG_METHOD(scene_raycast, "raycast");
     LUA_END_METATABLE("Scene");
     
     // Handle metatable (minimal, type-checking handled by Asc::Handle internally)
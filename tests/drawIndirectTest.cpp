@@ -0,0 +1,777 @@
+#include <vulkan/vulkan.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/* Indirect and direct draws against the shipped Test shaders
+
+Renders the same draws twice, offscreen, with the layout Renderer::drawTest() binds: sets 0-6
+(0, 2, 4, 5, 6 dynamic), a vertex only 4 byte push constant, static vertices at binding 0 and
+instances at binding 1. Once as a single vkCmdDrawIndexedIndirect with drawBase pushed
+(draws[drawBase + gl_DrawIDARB]), once per draw with drawBase + i pushed. Both images have to
+match each other and the material colors
+
+The commands and DrawData in front of drawBase are junk that paints magenta, any of it on
+screen means the shader indexed draws[] wrong. Needs a device with shaderDrawParameters,
+multiDrawIndirect and drawIndirectFirstInstance (lavapipe and SwiftShader have them), returns
+77 (skipped) without one
+
+    drawIndirectTest [shader dir]
+*/
+
+namespace {
+
+constexpr uint32_t W = 64, H = 64;
+constexpr uint32_t DRAWS = 8;     // One per submesh, a 4x2 grid of quads
+constexpr uint32_t DRAW_BASE = 3; // The mesh group's first command
+constexpr uint32_t ALIGN = 256;   // Dynamic offsets, no device asks for more
+constexpr uint32_t SKIP = 77;
+
+struct Vertex { float pos_tu[4], nrml_tv[4], tang[4]; };      // tinyVertex::Static
+struct Insta  { float model[16]; uint32_t other[4]; };        // tinyInstaData
+struct Draw   { uint32_t data0[4], data1[4], data2[4]; };     // tinyDrawable::DrawData
+struct Mat    { float base[4], empty[12]; uint32_t tex1[4], tex2[4]; };
+
+static_assert(sizeof(Insta) == 80 && sizeof(Draw) == 48 && sizeof(Mat) == 96, "shader side layouts");
+
+#define CHECK(x) do { VkResult r_ = (x); if (r_ != VK_SUCCESS) { std::printf("%s failed (%d)\n", #x, r_); std::exit(1); } } while (0)
+
+struct Gpu {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice pDevice = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t family = 0;
+    VkPhysicalDeviceMemoryProperties memProps{};
+    std::string name;
+
+    uint32_t memType(uint32_t bits, VkFlags want) const {
+        for (uint32_t i = 0; i < memProps.memoryTypeCount; ++i) {
+            if ((bits & (1u << i)) && (memProps.memoryTypes[i].propertyFlags & want) == want) return i;
+        }
+        std::printf("no memory type for %x\n", want);
+        std::exit(1);
+    }
+};
+
+struct Buffer {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    uint8_t* mapped = nullptr;
+    VkDeviceSize size = 0;
+
+    template<typename T>
+    T* at(VkDeviceSize offset) { return reinterpret_cast<T*>(mapped + offset); }
+};
+
+// Host visible, host coherent, mapped for good
+Buffer makeBuffer(const Gpu& gpu, VkDeviceSize size, VkFlags usage) {
+    Buffer out;
+    out.size = size;
+
+    VkBufferCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    info.size = size;
+    info.usage = usage;
+    info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    CHECK(vkCreateBuffer(gpu.device, &info, nullptr, &out.buffer));
+
+    VkMemoryRequirements req;
+    vkGetBufferMemoryRequirements(gpu.device, out.buffer, &req);
+
+    VkMemoryAllocateInfo alloc{};
+    alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc.allocationSize = req.size;
+    alloc.memoryTypeIndex = gpu.memType(req.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    VkDeviceMemory memory;
+    CHECK(vkAllocateMemory(gpu.device, &alloc, nullptr, &memory));
+    CHECK(vkBindBufferMemory(gpu.device, out.buffer, memory, 0));
+    CHECK(vkMapMemory(gpu.device, memory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void**>(&out.mapped)));
+    std::memset(out.mapped, 0, size);
+    return out;
+}
+
+VkImage makeImage(const Gpu& gpu, uint32_t w, uint32_t h, VkFlags usage, VkImageView& view) {
+    VkImageCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    info.imageType = VK_IMAGE_TYPE_2D;
+    info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    info.extent = { w, h, 1 };
+    info.mipLevels = 1;
+    info.arrayLayers = 1;
+    info.samples = VK_SAMPLE_COUNT_1_BIT;
+    info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    info.usage = usage;
+    info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    VkImage image;
+    CHECK(vkCreateImage(gpu.device, &info, nullptr, &image));
+
+    VkMemoryRequirements req;
+    vkGetImageMemoryRequirements(gpu.device, image, &req);
+
+    VkMemoryAllocateInfo alloc{};
+    alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc.allocationSize = req.size;
+    alloc.memoryTypeIndex = gpu.memType(req.memoryTypeBits, 0);
+
+    VkDeviceMemory memory;
+    CHECK(vkAllocateMemory(gpu.device, &alloc, nullptr, &memory));
+    CHECK(vkBindImageMemory(gpu.device, image, memory, 0));
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    CHECK(vkCreateImageView(gpu.device, &viewInfo, nullptr, &view));
+    return image;
+}
+
+void barrier(VkCommandBuffer cmd, VkImage image, VkImageLayout from, VkImageLayout to,
+             VkFlags srcAccess, VkFlags dstAccess, VkFlags srcStage, VkFlags dstStage) {
+    VkImageMemoryBarrier b{};
+    b.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    b.srcAccessMask = srcAccess;
+    b.dstAccessMask = dstAccess;
+    b.oldLayout = from;
+    b.newLayout = to;
+    b.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    b.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    b.image = image;
+    b.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    vkCmdPipelineBarrier(cmd, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &b);
+}
+
+bool readFile(const std::string& path, std::vector<uint32_t>& out) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    std::fseek(f, 0, SEEK_END);
+    long size = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+
+    out.resize(static_cast<size_t>(size) / 4);
+    bool ok = size > 0 && size % 4 == 0 && std::fread(out.data(), 4, out.size(), f) == out.size();
+    std::fclose(f);
+    return ok;
+}
+
+VkShaderModule loadShader(const Gpu& gpu, const std::string& path) {
+    std::vector<uint32_t> code;
+    if (!readFile(path, code)) { std::printf("can't read %s\n", path.c_str()); std::exit(1); }
+
+    VkShaderModuleCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    info.codeSize = code.size() * 4;
+    info.pCode = code.data();
+
+    VkShaderModule module;
+    CHECK(vkCreateShaderModule(gpu.device, &info, nullptr, &module));
+    return module;
+}
+
+// Device with what Device.cpp turns on for the Test pipeline, false if there is none
+bool createGpu(Gpu& gpu) {
+    VkApplicationInfo app{};
+    app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app.pApplicationName = "drawIndirectTest";
+    app.apiVersion = VK_API_VERSION_1_2;
+
+    VkInstanceCreateInfo instInfo{};
+    instInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instInfo.pApplicationInfo = &app;
+    if (vkCreateInstance(&instInfo, nullptr, &gpu.instance) != VK_SUCCESS) return false;
+
+    uint32_t count = 0;
+    vkEnumeratePhysicalDevices(gpu.instance, &count, nullptr);
+    std::vector<VkPhysicalDevice> pDevices(count);
+    vkEnumeratePhysicalDevices(gpu.instance, &count, pDevices.data());
+
+    for (VkPhysicalDevice pDevice : pDevices) {
+        VkPhysicalDeviceProperties props;
+        vkGetPhysicalDeviceProperties(pDevice, &props);
+        if (props.limits.maxBoundDescriptorSets < 7) continue; // SwiftShader has 4
+
+        VkPhysicalDeviceVulkan11Features vk11{};
+        vk11.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+        VkPhysicalDeviceVulkan12Features vk12{};
+        vk12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vk12.pNext = &vk11;
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &vk12;
+        vkGetPhysicalDeviceFeatures2(pDevice, &features2);
+
+        const VkPhysicalDeviceFeatures& f = features2.features;
+        if (!f.multiDrawIndirect || !f.drawIndirectFirstInstance || !vk11.shaderDrawParameters ||
+            !vk12.runtimeDescriptorArray || !vk12.descriptorBindingPartiallyBound ||
+            !vk12.descriptorBindingVariableDescriptorCount || !vk12.shaderSampledImageArrayNonUniformIndexing) continue;
+
+        uint32_t familyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(pDevice, &familyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> families(familyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(pDevice, &familyCount, families.data());
+
+        uint32_t family = familyCount;
+        for (uint32_t i = 0; i < familyCount && family == familyCount; ++i) {
+            if (families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) family = i;
+        }
+        if (family == familyCount) continue;
+
+        float priority = 1.0f;
+        VkDeviceQueueCreateInfo queueInfo{};
+        queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueInfo.queueFamilyIndex = family;
+        queueInfo.queueCount = 1;
+        queueInfo.pQueuePriorities = &priority;
+
+        VkPhysicalDeviceFeatures enable{};
+        enable.multiDrawIndirect = VK_TRUE;
+        enable.drawIndirectFirstInstance = VK_TRUE;
+
+        VkPhysicalDeviceVulkan11Features vk11On{};
+        vk11On.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+        vk11On.shaderDrawParameters = VK_TRUE;
+
+        VkPhysicalDeviceVulkan12Features vk12On{};
+        vk12On.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vk12On.pNext = &vk11On;
+        vk12On.descriptorIndexing = vk12.descriptorIndexing;
+        vk12On.runtimeDescriptorArray = VK_TRUE;
+        vk12On.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+        vk12On.descriptorBindingVariableDescriptorCount = VK_TRUE;
+        vk12On.descriptorBindingPartiallyBound = VK_TRUE;
+
+        VkDeviceCreateInfo info{};
+        info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        info.pNext = &vk12On;
+        info.queueCreateInfoCount = 1;
+        info.pQueueCreateInfos = &queueInfo;
+        info.pEnabledFeatures = &enable;
+        if (vkCreateDevice(pDevice, &info, nullptr, &gpu.device) != VK_SUCCESS) continue;
+
+        gpu.pDevice = pDevice;
+        gpu.name = props.deviceName;
+        gpu.family = family;
+        vkGetDeviceQueue(gpu.device, family, 0, &gpu.queue);
+        vkGetPhysicalDeviceMemoryProperties(pDevice, &gpu.memProps);
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------
+
+struct Scene {
+    Buffer glb, mats, skin, mrphWs, draws, cmds; // Sets 0, 2, 4, 5, 6 and the indirect commands
+    Buffer rigs, colors, mrphDlts;               // Set 1
+    Buffer vstatic, indx, insta;
+
+    VkDescriptorSetLayout layouts[7]{};
+    VkDescriptorSet sets[7]{};
+    VkPipelineLayout pLayout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+
+    // Per draw i, expected color at the center of cell i
+    float expect[DRAWS][3]{};
+};
+
+float cellX(uint32_t i) { return -0.75f + 0.5f * static_cast<float>(i % 4); }
+float cellY(uint32_t i) { return i < 4 ? -0.5f : 0.5f; }
+
+void fill(Scene& s, const Gpu& gpu) {
+    s.glb      = makeBuffer(gpu, ALIGN * 2, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    s.mats     = makeBuffer(gpu, ALIGN * 8, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    s.skin     = makeBuffer(gpu, ALIGN * 2, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    s.mrphWs   = makeBuffer(gpu, ALIGN * 2, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    s.draws    = makeBuffer(gpu, ALIGN * 4, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    s.cmds     = makeBuffer(gpu, ALIGN * 2, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+    s.rigs     = makeBuffer(gpu, ALIGN, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    s.colors   = makeBuffer(gpu, ALIGN * 8, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    s.mrphDlts = makeBuffer(gpu, ALIGN, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    s.vstatic  = makeBuffer(gpu, sizeof(Vertex) * 4 * (DRAWS + 1), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+    s.indx     = makeBuffer(gpu, sizeof(uint32_t) * 6 * DRAWS, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+    s.insta    = makeBuffer(gpu, sizeof(Insta) * (2 * DRAWS + 1), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+
+    // Set 0, offset ALIGN: proj = view = identity, positions are already in clip space
+    float* glb = s.glb.at<float>(ALIGN);
+    for (int m = 0; m < 2; ++m) for (int k = 0; k < 4; ++k) glb[m * 16 + k * 5] = 1.0f;
+
+    // Materials at offset ALIGN. 0..DRAWS-1 are the real ones, DRAWS is the junk magenta
+    Mat* mats = s.mats.at<Mat>(ALIGN);
+    for (uint32_t m = 0; m <= DRAWS; ++m) {
+        float r = m == DRAWS ? 1.0f : 0.2f + 0.1f * static_cast<float>(m);
+        float g = m == DRAWS ? 0.0f : 0.9f - 0.1f * static_cast<float>(m);
+        float b = m == DRAWS ? 1.0f : (m % 2 ? 0.75f : 0.25f);
+        mats[m] = Mat{ { r, g, b, 1.0f }, {}, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    }
+
+    // One quad per submesh, vertex 0 unused so every vstatic offset is non zero
+    Vertex* verts = s.vstatic.at<Vertex>(0);
+    uint32_t* indx = s.indx.at<uint32_t>(0);
+    const float corner[4][2] = { { -0.1f, -0.1f }, { 0.1f, -0.1f }, { 0.1f, 0.1f }, { -0.1f, 0.1f } };
+    for (uint32_t i = 0; i < DRAWS; ++i) {
+        for (uint32_t v = 0; v < 4; ++v) {
+            verts[1 + i * 4 + v] = Vertex{ { corner[v][0], corner[v][1], 0.5f, 0.5f }, { 0.0f, 0.0f, 1.0f, 0.5f }, { 1.0f, 0.0f, 0.0f, 0.0f } };
+        }
+        const uint32_t quad[6] = { 0, 1, 2, 0, 2, 3 };
+        for (uint32_t k = 0; k < 6; ++k) indx[i * 6 + k] = quad[k]; // Relative, vertexOffset does the rest
+    }
+
+    // Instance i at 2i + 1, junk in between: a wrong firstInstance lands somewhere visible
+    Insta* insta = s.insta.at<Insta>(0);
+    for (uint32_t k = 0; k < 2 * DRAWS + 1; ++k) {
+        Insta& in = insta[k];
+        std::memset(&in, 0, sizeof(in));
+        for (int d = 0; d < 4; ++d) in.model[d * 5] = 1.0f;
+        bool real = k % 2 == 1;
+        uint32_t i = (k - 1) / 2;
+        in.model[12] = real ? cellX(i) : 0.0f;
+        in.model[13] = real ? cellY(i) : 0.0f;
+    }
+
+    // Set 1: draw 5 takes its colors from the vertex color buffer
+    constexpr uint32_t COLORED = 5, COLOR_OFFSET = 7;
+    float* colors = s.colors.at<float>(0);
+    for (uint32_t v = 0; v < 64; ++v) {
+        colors[v * 4 + 0] = 0.5f; colors[v * 4 + 1] = 1.0f; colors[v * 4 + 2] = 0.0f; colors[v * 4 + 3] = 1.0f;
+    }
+
+    // Set 6 at offset ALIGN, commands in front of drawBase are junk
+    Draw* draws = s.draws.at<Draw>(ALIGN);
+    auto* cmds = s.cmds.at<VkDrawIndexedIndirectCommand>(0);
+    for (uint32_t d = 0; d < DRAW_BASE + DRAWS; ++d) {
+        bool real = d >= DRAW_BASE;
+        uint32_t i = real ? d - DRAW_BASE : d;
+
+        Draw& draw = draws[d];
+        std::memset(&draw, 0, sizeof(draw));
+        draw.data0[0] = real && i == COLORED ? 4u : 0u; // VERTEX_FLAG_COLOR
+        draw.data0[1] = 4;
+        draw.data0[3] = real ? i : DRAWS;
+        draw.data1[0] = 1 + i * 4;
+        draw.data1[2] = COLOR_OFFSET;
+
+        // Junk draws cover the real quads, wrong indexing repaints them magenta
+        cmds[d] = VkDrawIndexedIndirectCommand{ 6, 1, i * 6, static_cast<int32_t>(1 + i * 4), 2 * i + 1 };
+    }
+
+    const float lDot = 0.95f + 0.05f * (1.0f / std::sqrt(3.0f));
+    for (uint32_t i = 0; i < DRAWS; ++i) {
+        const float* tint = i == COLORED ? colors : nullptr;
+        for (int c = 0; c < 3; ++c) s.expect[i][c] = mats[i].base[c] * (tint ? tint[c] : 1.0f) * lDot;
+    }
+}
+
+VkDescriptorSetLayout makeLayout(const Gpu& gpu, std::vector<VkDescriptorSetLayoutBinding> bindings, const VkFlags* flags = nullptr) {
+    VkDescriptorSetLayoutBindingFlagsCreateInfo flagInfo{};
+    flagInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    flagInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    flagInfo.pBindingFlags = flags;
+
+    VkDescriptorSetLayoutCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    info.pNext = flags ? &flagInfo : nullptr;
+    info.bindingCount = static_cast<uint32_t>(bindings.size());
+    info.pBindings = bindings.data();
+
+    VkDescriptorSetLayout layout;
+    CHECK(vkCreateDescriptorSetLayout(gpu.device, &info, nullptr, &layout));
+    return layout;
+}
+
+void writeBuffer(const Gpu& gpu, VkDescriptorSet set, uint32_t binding, VkDescriptorType type, const Buffer& buffer, VkDeviceSize range) {
+    VkDescriptorBufferInfo bufferInfo{ buffer.buffer, 0, range };
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = set;
+    write.dstBinding = binding;
+    write.descriptorCount = 1;
+    write.descriptorType = type;
+    write.pBufferInfo = &bufferInfo;
+    vkUpdateDescriptorSets(gpu.device, 1, &write, 0, nullptr);
+}
+
+void build(Scene& s, const Gpu& gpu, const std::string& shaderDir, VkImageView texView) {
+    constexpr VkFlags V = VK_SHADER_STAGE_VERTEX_BIT, F = VK_SHADER_STAGE_FRAGMENT_BIT;
+    constexpr uint32_t MAX_TEXTURES = 16;
+
+    s.layouts[0] = makeLayout(gpu, { { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1, V | F, nullptr } });
+    s.layouts[1] = makeLayout(gpu, { { 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, V, nullptr },
+                                     { 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, V, nullptr },
+                                     { 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, V, nullptr } });
+    s.layouts[2] = makeLayout(gpu, { { 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, F, nullptr } });
+
+    const VkFlags texFlags = VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    s.layouts[3] = makeLayout(gpu, { { 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, MAX_TEXTURES, F, nullptr } }, &texFlags);
+
+    s.layouts[4] = makeLayout(gpu, { { 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, V, nullptr } });
+    s.layouts[5] = makeLayout(gpu, { { 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, V, nullptr } });
+    s.layouts[6] = makeLayout(gpu, { { 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, V, nullptr } });
+
+    VkDescriptorPoolSize sizes[] = {
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1 },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3 },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 4 },
+        { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, MAX_TEXTURES }
+    };
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.maxSets = 7;
+    poolInfo.poolSizeCount = 4;
+    poolInfo.pPoolSizes = sizes;
+
+    VkDescriptorPool pool;
+    CHECK(vkCreateDescriptorPool(gpu.device, &poolInfo, nullptr, &pool));
+
+    // Set 3 gets a variable count, the rest ignore it
+    uint32_t counts[7] = { 0, 0, 0, MAX_TEXTURES, 0, 0, 0 };
+    VkDescriptorSetVariableDescriptorCountAllocateInfo countInfo{};
+    countInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
+    countInfo.descriptorSetCount = 7;
+    countInfo.pDescriptorCounts = counts;
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.pNext = &countInfo;
+    allocInfo.descriptorPool = pool;
+    allocInfo.descriptorSetCount = 7;
+    allocInfo.pSetLayouts = s.layouts;
+    CHECK(vkAllocateDescriptorSets(gpu.device, &allocInfo, s.sets));
+
+    writeBuffer(gpu, s.sets[0], 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, s.glb, ALIGN);
+    writeBuffer(gpu, s.sets[1], 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, s.rigs, VK_WHOLE_SIZE);
+    writeBuffer(gpu, s.sets[1], 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, s.colors, VK_WHOLE_SIZE);
+    writeBuffer(gpu, s.sets[1], 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, s.mrphDlts, VK_WHOLE_SIZE);
+    writeBuffer(gpu, s.sets[2], 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, s.mats, ALIGN * 4);
+    writeBuffer(gpu, s.sets[4], 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, s.skin, ALIGN);
+    writeBuffer(gpu, s.sets[5], 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, s.mrphWs, ALIGN);
+    writeBuffer(gpu, s.sets[6], 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, s.draws, ALIGN * 2);
+
+    // Only texture 0 (white) is written, partially bound
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.maxLod = 1.0f;
+    VkSampler sampler;
+    CHECK(vkCreateSampler(gpu.device, &samplerInfo, nullptr, &sampler));
+
+    VkDescriptorImageInfo imageInfo{ sampler, texView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    VkWriteDescriptorSet texWrite{};
+    texWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    texWrite.dstSet = s.sets[3];
+    texWrite.descriptorCount = 1;
+    texWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    texWrite.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(gpu.device, 1, &texWrite, 0, nullptr);
+
+    // Pipeline layout as in tinyApp: one uint for drawBase, vertex only
+    VkPushConstantRange push{ V, 0, sizeof(uint32_t) };
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 7;
+    layoutInfo.pSetLayouts = s.layouts;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &push;
+    CHECK(vkCreatePipelineLayout(gpu.device, &layoutInfo, nullptr, &s.pLayout));
+
+    VkAttachmentDescription color{};
+    color.format = VK_FORMAT_R8G8B8A8_UNORM;
+    color.samples = VK_SAMPLE_COUNT_1_BIT;
+    color.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    color.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    color.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    color.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    color.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    color.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference colorRef{ 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorRef;
+
+    VkRenderPassCreateInfo rpInfo{};
+    rpInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    rpInfo.attachmentCount = 1;
+    rpInfo.pAttachments = &color;
+    rpInfo.subpassCount = 1;
+    rpInfo.pSubpasses = &subpass;
+    CHECK(vkCreateRenderPass(gpu.device, &rpInfo, nullptr, &s.renderPass));
+
+    VkPipelineShaderStageCreateInfo stages[2]{};
+    stages[0].sType = stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = loadShader(gpu, shaderDir + "/Test.vert.spv");
+    stages[0].pName = "main";
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = loadShader(gpu, shaderDir + "/Test.frag.spv");
+    stages[1].pName = "main";
+
+    VkVertexInputBindingDescription bindings[] = {
+        { 0, sizeof(Vertex), VK_VERTEX_INPUT_RATE_VERTEX },
+        { 1, sizeof(Insta), VK_VERTEX_INPUT_RATE_INSTANCE }
+    };
+    VkVertexInputAttributeDescription attrs[] = {
+        { 0, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 0 },
+        { 1, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 16 },
+        { 2, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 32 },
+        { 3, 1, VK_FORMAT_R32G32B32A32_SFLOAT, 0 },
+        { 4, 1, VK_FORMAT_R32G32B32A32_SFLOAT, 16 },
+        { 5, 1, VK_FORMAT_R32G32B32A32_SFLOAT, 32 },
+        { 6, 1, VK_FORMAT_R32G32B32A32_SFLOAT, 48 },
+        { 7, 1, VK_FORMAT_R32G32B32A32_UINT, 64 }
+    };
+    VkPipelineVertexInputStateCreateInfo vertexInput{};
+    vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInput.vertexBindingDescriptionCount = 2;
+    vertexInput.pVertexBindingDescriptions = bindings;
+    vertexInput.vertexAttributeDescriptionCount = 8;
+    vertexInput.pVertexAttributeDescriptions = attrs;
+
+    VkPipelineInputAssemblyStateCreateInfo assembly{};
+    assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    VkViewport viewport{ 0.0f, 0.0f, float(W), float(H), 0.0f, 1.0f };
+    VkRect2D scissor{ { 0, 0 }, { W, H } };
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.pViewports = &viewport;
+    viewportState.scissorCount = 1;
+    viewportState.pScissors = &scissor;
+
+    VkPipelineRasterizationStateCreateInfo raster{};
+    raster.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    raster.polygonMode = VK_POLYGON_MODE_FILL;
+    raster.cullMode = VK_CULL_MODE_NONE;
+    raster.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    raster.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisample{};
+    multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkPipelineColorBlendAttachmentState blendAttachment{};
+    blendAttachment.colorWriteMask = 0xF;
+    VkPipelineColorBlendStateCreateInfo blend{};
+    blend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blend.attachmentCount = 1;
+    blend.pAttachments = &blendAttachment;
+
+    VkGraphicsPipelineCreateInfo pInfo{};
+    pInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pInfo.stageCount = 2;
+    pInfo.pStages = stages;
+    pInfo.pVertexInputState = &vertexInput;
+    pInfo.pInputAssemblyState = &assembly;
+    pInfo.pViewportState = &viewportState;
+    pInfo.pRasterizationState = &raster;
+    pInfo.pMultisampleState = &multisample;
+    pInfo.pColorBlendState = &blend;
+    pInfo.layout = s.pLayout;
+    pInfo.renderPass = s.renderPass;
+    pInfo.basePipelineIndex = -1;
+    CHECK(vkCreateGraphicsPipelines(gpu.device, VK_NULL_HANDLE, 1, &pInfo, nullptr, &s.pipeline));
+}
+
+// ---------------------------------------------------------------
+
+VkCommandBuffer beginCmd(const Gpu& gpu, VkCommandPool pool) {
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = pool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    VkCommandBuffer cmd;
+    CHECK(vkAllocateCommandBuffers(gpu.device, &allocInfo, &cmd));
+
+    VkCommandBufferBeginInfo begin{};
+    begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    CHECK(vkBeginCommandBuffer(cmd, &begin));
+    return cmd;
+}
+
+void submitCmd(const Gpu& gpu, VkCommandBuffer cmd) {
+    CHECK(vkEndCommandBuffer(cmd));
+
+    VkSubmitInfo submit{};
+    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &cmd;
+    CHECK(vkQueueSubmit(gpu.queue, 1, &submit, VK_NULL_HANDLE));
+    CHECK(vkQueueWaitIdle(gpu.queue));
+}
+
+// The drawTest() loop for one mesh group, either path. Returns the image, RGBA8 rows
+std::vector<uint8_t> render(const Gpu& gpu, const Scene& s, VkCommandPool pool, bool indirect) {
+    VkImageView view;
+    VkImage target = makeImage(gpu, W, H, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, view);
+    Buffer readback = makeBuffer(gpu, W * H * 4, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkFramebufferCreateInfo fbInfo{};
+    fbInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    fbInfo.renderPass = s.renderPass;
+    fbInfo.attachmentCount = 1;
+    fbInfo.pAttachments = &view;
+    fbInfo.width = W;
+    fbInfo.height = H;
+    fbInfo.layers = 1;
+    VkFramebuffer framebuffer;
+    CHECK(vkCreateFramebuffer(gpu.device, &fbInfo, nullptr, &framebuffer));
+
+    VkCommandBuffer cmd = beginCmd(gpu, pool);
+
+    VkClearValue clear{};
+    VkRenderPassBeginInfo rpBegin{};
+    rpBegin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    rpBegin.renderPass = s.renderPass;
+    rpBegin.framebuffer = framebuffer;
+    rpBegin.renderArea = { { 0, 0 }, { W, H } };
+    rpBegin.clearValueCount = 1;
+    rpBegin.pClearValues = &clear;
+    vkCmdBeginRenderPass(cmd, &rpBegin, VK_SUBPASS_CONTENTS_INLINE);
+
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pipeline);
+
+    const uint32_t offset = ALIGN;
+    const uint32_t zero = 0;
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pLayout, 0, 1, &s.sets[0], 1, &offset);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pLayout, 2, 1, &s.sets[2], 1, &offset);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pLayout, 3, 1, &s.sets[3], 0, nullptr);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pLayout, 4, 1, &s.sets[4], 1, &zero);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pLayout, 5, 1, &s.sets[5], 1, &zero);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pLayout, 6, 1, &s.sets[6], 1, &offset);
+
+    VkDeviceSize instaOffset = 0;
+    vkCmdBindVertexBuffers(cmd, 1, 1, &s.insta.buffer, &instaOffset);
+
+    VkDeviceSize vOffset = 0;
+    vkCmdBindVertexBuffers(cmd, 0, 1, &s.vstatic.buffer, &vOffset);
+    vkCmdBindIndexBuffer(cmd, s.indx.buffer, 0, VK_INDEX_TYPE_UINT32);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, s.pLayout, 1, 1, &s.sets[1], 0, nullptr);
+
+    constexpr uint32_t stride = sizeof(VkDrawIndexedIndirectCommand);
+    if (indirect) {
+        uint32_t drawBase = DRAW_BASE;
+        vkCmdPushConstants(cmd, s.pLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(uint32_t), &drawBase);
+        vkCmdDrawIndexedIndirect(cmd, s.cmds.buffer, VkDeviceSize(DRAW_BASE) * stride, DRAWS, stride);
+    } else {
+        const auto* cmds = reinterpret_cast<const VkDrawIndexedIndirectCommand*>(s.cmds.mapped);
+        for (uint32_t i = 0; i < DRAWS; ++i) {
+            const VkDrawIndexedIndirectCommand& c = cmds[DRAW_BASE + i];
+            uint32_t drawBase = DRAW_BASE + i;
+            vkCmdPushConstants(cmd, s.pLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(uint32_t), &drawBase);
+            vkCmdDrawIndexed(cmd, c.indexCount, c.instanceCount, c.firstIndex, c.vertexOffset, c.firstInstance);
+        }
+    }
+
+    vkCmdEndRenderPass(cmd);
+
+    barrier(cmd, target, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+    VkBufferImageCopy region{};
+    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+    region.imageExtent = { W, H, 1 };
+    vkCmdCopyImageToBuffer(cmd, target, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readback.buffer, 1, &region);
+
+    submitCmd(gpu, cmd);
+    return std::vector<uint8_t>(readback.mapped, readback.mapped + W * H * 4);
+}
+
+// Center of every cell against its material, 0 on a match
+int check(const Scene& s, const std::vector<uint8_t>& image, const char* path) {
+    int bad = 0;
+    for (uint32_t i = 0; i < DRAWS; ++i) {
+        uint32_t x = static_cast<uint32_t>((cellX(i) + 1.0f) * 0.5f * W);
+        uint32_t y = static_cast<uint32_t>((cellY(i) + 1.0f) * 0.5f * H);
+        const uint8_t* px = &image[(y * W + x) * 4];
+
+        for (int c = 0; c < 3; ++c) {
+            int want = static_cast<int>(std::lround(s.expect[i][c] * 255.0f));
+            if (std::abs(px[c] - want) > 2) {
+                std::printf("%s: draw %u at (%u, %u) is %u %u %u, expected %.0f %.0f %.0f\n", path, i, x, y,
+                            px[0], px[1], px[2], s.expect[i][0] * 255.0f, s.expect[i][1] * 255.0f, s.expect[i][2] * 255.0f);
+                bad = 1;
+                break;
+            }
+        }
+    }
+
+    // Junk draws are magenta (material DRAWS), none of them may show
+    for (uint32_t p = 0; p < W * H; ++p) {
+        const uint8_t* px = &image[p * 4];
+        if (px[0] > 200 && px[1] < 8 && px[2] > 200) {
+            std::printf("%s: junk draw data at (%u, %u)\n", path, p % W, p / W);
+            return 1;
+        }
+    }
+    return bad;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string shaderDir = argc > 1 ? argv[1] : "Shaders/bin/Test";
+
+    Gpu gpu;
+    if (!createGpu(gpu)) {
+        std::printf("skipped: no device with shaderDrawParameters, multiDrawIndirect and 7 descriptor sets\n");
+        return SKIP;
+    }
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.queueFamilyIndex = gpu.family;
+    VkCommandPool pool;
+    CHECK(vkCreateCommandPool(gpu.device, &poolInfo, nullptr, &pool));
+
+    // Texture 0: 1x1 white, what the drawable's dummy texture is
+    VkImageView texView;
+    VkImage texture = makeImage(gpu, 1, 1, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, texView);
+    {
+        VkCommandBuffer cmd = beginCmd(gpu, pool);
+        barrier(cmd, texture, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+        VkClearColorValue white{ { 1.0f, 1.0f, 1.0f, 1.0f } };
+        VkImageSubresourceRange range{ VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+        vkCmdClearColorImage(cmd, texture, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &white, 1, &range);
+
+        barrier(cmd, texture, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+        submitCmd(gpu, cmd);
+    }
+
+    Scene scene;
+    fill(scene, gpu);
+    build(scene, gpu, shaderDir, texView);
+
+    std::vector<uint8_t> indirect = render(gpu, scene, pool, true);
+    std::vector<uint8_t> direct   = render(gpu, scene, pool, false);
+
+    int bad = check(scene, indirect, "indirect") | check(scene, direct, "direct");
+    if (indirect != direct) {
+        std::printf("indirect and direct images differ\n");
+        bad = 1;
+    }
+    if (bad) return 1;
+
+    std::printf("ok: %u draws on %s, indirect (drawBase %u) and direct match\n", DRAWS, gpu.name.c_str(), DRAW_BASE);
+    return 0;
+}
@@ -0,0 +1,225 @@
+#include "tinyEngine/tinyDrawList.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+/* Retained list uploads against a simulated GPU
+
+Every frame slot keeps its own copy of the instance buffer. Lists go in through upload() the
+way tinyDrawable::submit(List&) does it: back to back from the start of the slot, then junk
+after them the way per frame instances land there. What the draws would then read (forEachRun
+over the slot) has to match the items the test tracked on its own, every frame
+
+Random adds, small moves, moves across cells, removes, clears, change bursts that overflow
+the log, idle frames, lists skipped or submitted in another order, and a shifted start now
+and then so the same list lands somewhere else
+
+    drawListTest [frames] [seeds]
+*/
+
+namespace {
+
+constexpr uint32_t SLOT_SIZE = 1 << 16; // Instances per frame slot
+constexpr uint32_t MESHES = 6;
+constexpr uint32_t LISTS = 3;
+
+struct Tracked { // What the test expects one list to hold
+    tinyDrawList list;
+    std::vector<Asc::Handle> items;
+    std::unordered_map<Asc::Handle, std::pair<Asc::Handle, glm::mat4>> truth; // item -> mesh, model
+
+    explicit Tracked(float cellSize) : list(cellSize) {}
+};
+
+struct Stats {
+    uint64_t uploads = 0;
+    uint64_t deltas = 0; // Uploads that only wrote the changes
+    uint64_t checked = 0;
+};
+
+// (mesh, model bits), sorted both sides to compare as multisets
+using Key = std::array<uint32_t, 17>;
+
+Key keyOf(Asc::Handle mesh, const glm::mat4& model) {
+    Key key{};
+    key[0] = mesh.index;
+    std::memcpy(key.data() + 1, &model, sizeof(glm::mat4));
+    return key;
+}
+
+// The slot's copy of one list against the tracked items, 0 on a match
+int verify(const Tracked& t, const std::vector<tinyInstaData>& slot, uint32_t base, uint32_t size, Stats& stats) {
+    std::vector<Key> want;
+    want.reserve(t.truth.size());
+    for (const auto& kv : t.truth) want.push_back(keyOf(kv.second.first, kv.second.second));
+
+    std::vector<Key> got;
+    got.reserve(want.size());
+    std::vector<bool> covered(size, false);
+    int bad = 0;
+
+    t.list.forEachRun([&](Asc::Handle mesh, uint32_t offset, uint32_t count) {
+        if (bad) return;
+        if (offset + count > size) { std::printf("run [%u, +%u) past the range (%u)\n", offset, count, size); bad = 1; return; }
+
+        for (uint32_t k = 0; k < count; ++k) {
+            if (covered[offset + k]) { std::printf("runs overlap at %u\n", offset + k); bad = 1; return; }
+            covered[offset + k] = true;
+            got.push_back(keyOf(mesh, slot[base + offset + k].model));
+        }
+    });
+    if (bad) return bad;
+
+    std::sort(want.begin(), want.end());
+    std::sort(got.begin(), got.end());
+    if (got != want) {
+        std::printf("slot holds %zu instances, %zu expected, or the wrong ones\n", got.size(), want.size());
+        return 1;
+    }
+
+    stats.checked += want.size();
+    return 0;
+}
+
+int run(uint32_t seed, uint32_t frames, uint32_t slots, Stats& stats) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> near(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> far(-200.0f, 200.0f);
+
+    auto randomMesh = [&] { return Asc::Handle(rng() % MESHES, 0, 1); };
+    auto randomModel = [&] {
+        glm::mat4 model(1.0f);
+        model[3] = glm::vec4(far(rng), far(rng) * 0.1f, far(rng), 1.0f);
+        model[0][0] = 1.0f + near(rng) * 0.5f;
+        return model;
+    };
+
+    std::vector<Tracked> lists;
+    for (uint32_t l = 0; l < LISTS; ++l) lists.emplace_back(l == 0 ? 8.0f : 64.0f);
+
+    // Poisoned so a slot read that nothing wrote never matches
+    tinyInstaData poison;
+    poison.model = glm::mat4(std::nanf(""));
+    std::vector<std::vector<tinyInstaData>> gpu(slots, std::vector<tinyInstaData>(SLOT_SIZE, poison));
+    std::vector<tinyDrawList::Slot> records(slots);
+
+    for (uint32_t f = 0; f < frames; ++f) {
+        // Mutate. Most frames only nudge a few instances, like a scene with a moving part;
+        // adds, removes and jumps come in their own frames since they tend to relayout
+        for (Tracked& t : lists) {
+            uint32_t mode = rng() % 100;
+            uint32_t ops = mode < 25 ? 0 :                    // Idle
+                           mode < 27 ? 1500 + rng() % 1500 : // Burst, outgrows the log
+                           rng() % 24;
+            bool structural = mode >= 90 || t.items.size() < 64;
+
+            for (uint32_t o = 0; o < ops; ++o) {
+                uint32_t op = structural ? rng() % 100 : 30 + rng() % 40;
+                if (t.items.empty() || op < 30) {
+                    if (t.list.count() > 3000) continue;
+                    Asc::Handle mesh = randomMesh();
+                    glm::mat4 model = randomModel();
+                    Asc::Handle item = t.list.add(mesh, model);
+                    t.items.push_back(item);
+                    t.truth[item] = { mesh, model };
+                    continue;
+                }
+
+                size_t at = rng() % t.items.size();
+                Asc::Handle item = t.items[at];
+                auto& truth = t.truth[item];
+
+                if (op < 70) { // Nudge, mostly stays in its cell
+                    truth.second[3] += glm::vec4(near(rng), 0.0f, near(rng), 0.0f) * 0.25f;
+                    t.list.move(item, truth.second);
+                } else if (op < 85) { // Jump, changes groups
+                    truth.second = randomModel();
+                    t.list.move(item, truth.second);
+                } else {
+                    t.list.remove(item);
+                    t.truth.erase(item);
+                    t.items[at] = t.items.back();
+                    t.items.pop_back();
+                }
+            }
+
+            if (rng() % 400 == 0) {
+                t.list.clear();
+                t.items.clear();
+                t.truth.clear();
+            }
+        }
+
+        // Submit: which lists, in what order, from where
+        std::vector<uint32_t> order;
+        for (uint32_t l = 0; l < LISTS; ++l) {
+            if (rng() % 10) order.push_back(l);
+        }
+        if (rng() % 8 == 0) std::shuffle(order.begin(), order.end(), rng);
+
+        uint32_t slot = f % slots;
+        uint32_t base = rng() % 16 == 0 ? 1 + rng() % 64 : 0;
+
+        struct Placed { uint32_t list, base, size; };
+        std::vector<Placed> placed;
+
+        records[slot].begin();
+        for (uint32_t l : order) {
+            Tracked& t = lists[l];
+            uint32_t size = t.list.rangeSize();
+            if (base + size > SLOT_SIZE) { std::printf("seed %u frame %u: slot too small\n", seed, f); return 1; }
+
+            stats.uploads++;
+            stats.deltas += records[slot].upload(t.list, gpu[slot].data() + base, base, slots);
+
+            placed.push_back({ l, base, size });
+            base += size;
+        }
+        records[slot].end();
+
+        // Per frame instances after the lists
+        uint32_t junk = std::min<uint32_t>(rng() % 4096, SLOT_SIZE - base);
+        std::fill_n(gpu[slot].begin() + base, junk, poison);
+
+        // What the GPU reads this frame
+        for (const Placed& p : placed) {
+            if (verify(lists[p.list], gpu[slot], p.base, p.size, stats)) {
+                std::printf("seed %u frame %u slot %u list %u: mismatch\n", seed, f, slot, p.list);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t frames = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 2000;
+    uint32_t seeds  = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 4;
+
+    Stats stats;
+    for (uint32_t seed = 1; seed <= seeds; ++seed) {
+        for (uint32_t slots = 2; slots <= 3; ++slots) {
+            if (run(seed, frames, slots, stats)) return 1;
+        }
+    }
+
+    // A run that never hit the delta path proves nothing about it
+    if (stats.deltas * 8 < stats.uploads) {
+        std::printf("only %llu of %llu uploads took the delta path\n",
+                    (unsigned long long)stats.deltas, (unsigned long long)stats.uploads);
+        return 1;
+    }
+
+    std::printf("ok: %llu uploads (%llu deltas), %llu instances checked\n",
+                (unsigned long long)stats.uploads, (unsigned long long)stats.deltas,
+                (unsigned long long)stats.checked);
+    return 0;
+}
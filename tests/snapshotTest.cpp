@@ -0,0 +1,298 @@
+#include "tinyRT/rtScene.hpp"
+#include "tinyRT/rtSnapshot.hpp"
+#include "tinyScript/tinyScript.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace tinyRT;
+
+/* Scene snapshots
+
+Round trip: a scene with every kind of record (names, transforms, static and posed meshes,
+posed skeletons, script vars of every type, node and resource handles) saves, loads into a
+fresh scene and saves again to the same bytes
+
+Fuzz: the saved file with bit flips, truncations, out of range counts/offsets/indices. load()
+either rejects it or builds a tree that saves and loads again. Nothing in here may read out
+of bounds, build with -DASCZ_TEST_SANITIZE=ON to have that checked
+
+    snapshotTest [rounds]
+*/
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+bool readFile(const std::string& path, Bytes& out) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    out.clear();
+    uint8_t buf[4096];
+    for (size_t got; (got = std::fread(buf, 1, sizeof(buf), f)) > 0;) out.insert(out.end(), buf, buf + got);
+    std::fclose(f);
+    return true;
+}
+
+bool writeFile(const std::string& path, const Bytes& bytes) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return false;
+
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+struct Resources {
+    Asc::Reg fsr;
+    std::vector<Asc::Handle> meshes;
+    Asc::Handle skeleton;
+    Asc::Handle script;
+
+    Resources() {
+        for (int m = 0; m < 6; ++m) {
+            tinyMesh mesh;
+            tinyMesh::Submesh submesh;
+
+            std::vector<tinyVertex::Static> vrtxs(3);
+            vrtxs[0].setPos(glm::vec3(float(m)));
+            submesh.setVrtxStatic(vrtxs);
+            submesh.setIndxs({ 0, 1, 2 });
+            submesh.expandAABB(glm::vec3(-1.0f));
+            submesh.expandAABB(glm::vec3(1.0f));
+            mesh.append(std::move(submesh));
+
+            if (m == 3) mesh.setMrphTargetNames({ "a", "b", "c" });
+            meshes.push_back(fsr.emplace<tinyMesh>(std::move(mesh)));
+        }
+
+        tinySkeleton skele;
+        for (int b = 0; b < 4; ++b) {
+            tinyBone bone;
+            bone.name = "bone" + std::to_string(b);
+            bone.parent = b - 1;
+            bone.bindPose = glm::translate(glm::mat4(1.0f), glm::vec3(float(b), 0.0f, 0.0f));
+            skele.insert(bone);
+        }
+        skeleton = fsr.emplace<tinySkeleton>(std::move(skele));
+
+        tinyScript scr;
+        scr.code = "VARS = { speed = 2 }";
+        script = fsr.emplace<tinyScript>(std::move(scr));
+    }
+
+    SceneRes res() { // No drawable, save/load never draw
+        SceneRes r;
+        r.fsr = &fsr;
+        return r;
+    }
+};
+
+void build(Scene& scene, Resources& rs, uint32_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<Asc::Handle> nodes{ scene.rootHandle() };
+
+    for (uint32_t i = 1; i < count; ++i) {
+        // Mostly deep chains with some fan out, names repeat
+        Asc::Handle parent = rng() % 4 ? nodes[nodes.size() - 1 - rng() % std::min<size_t>(nodes.size(), 8)]
+                                       : nodes[rng() % nodes.size()];
+        Asc::Handle h = scene.nAdd("node" + std::to_string(i % 97), parent);
+        nodes.push_back(h);
+
+        scene.nWriteComp<rtTRANFM3D>(h)->setPos({ float(i), 1.0f, -2.0f })
+                                        .setRot(glm::angleAxis(0.1f * i, glm::vec3(0.0f, 1.0f, 0.0f)))
+                                        .setScl({ 1.0f, 2.0f, 0.5f });
+
+        if (i % 3 == 0) {
+            Asc::Handle mesh = rs.meshes[rng() % rs.meshes.size()];
+            scene.nWriteComp<rtMESHRD3D>(h)->assignMesh(mesh, rs.fsr.get<tinyMesh>(mesh)).setStatic(rng() % 2);
+        }
+        if (i % 50 == 1) scene.nWriteComp<rtSKELE3D>(h)->init(&rs.fsr.view<tinySkeleton>(), rs.skeleton);
+    }
+
+    // A posed skeleton, a skinned mesh with morph weights, a script with one var of every kind
+    Asc::Handle skeleNode = nodes[1];
+    scene.nGetComp<rtSKELE3D>(skeleNode)->localPose(2) = glm::scale(glm::mat4(1.0f), glm::vec3(5.0f));
+
+    rtMESHRD3D* mesh = scene.nWriteComp<rtMESHRD3D>(nodes[4]);
+    mesh->assignMesh(rs.meshes[3], rs.fsr.get<tinyMesh>(rs.meshes[3])).assignSkeleNode(skeleNode);
+    mesh->mrphWeights()[1] = 0.75f;
+
+    rtSCRIPT* script = scene.nWriteComp<rtSCRIPT>(nodes[5]);
+    script->scriptHandle = rs.script;
+    script->vars["f"] = 3.5f;
+    script->vars["i"] = -7;
+    script->vars["b"] = true;
+    script->vars["v2"] = glm::vec2(1.0f, 2.0f);
+    script->vars["v3"] = glm::vec3(1.0f, 2.0f, 3.0f);
+    script->vars["v4"] = glm::vec4(1.0f, 2.0f, 3.0f, 4.0f);
+    script->vars["s"] = std::string("hello");
+    script->vars["node"] = nodes[4];
+    script->vars["res"] = rs.meshes[2];
+    script->vars["fs"] = std::vector<float>{ 1.0f, 2.0f };
+    script->vars["is"] = std::vector<int>{ 3, 4, 5 };
+    script->vars["bs"] = std::vector<bool>{ true, false, true };
+    script->vars["v2s"] = std::vector<glm::vec2>{ { 1.0f, 2.0f } };
+    script->vars["v3s"] = std::vector<glm::vec3>{ { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+    script->vars["v4s"] = std::vector<glm::vec4>{ glm::vec4(7.0f) };
+    script->vars["ss"] = std::vector<std::string>{ "a", "", "ccc" };
+    script->vars["hs"] = std::vector<Asc::Handle>{ nodes[7], rs.skeleton, Asc::Handle() };
+
+    scene.flush();
+}
+
+// Everything a loaded tree hands out has to be walkable
+uint32_t walk(const Scene& scene, Asc::Handle root) {
+    uint32_t comps = 0;
+    for (Asc::Handle h : scene.nQueue(root)) {
+        const auto* node = scene.node(h);
+        if (!node) { std::printf("queue hands out a dead node\n"); std::exit(1); }
+
+        (void)scene.nName(h).size();
+        if (const rtMESHRD3D* mesh = scene.nGetComp<rtMESHRD3D>(h)) comps += 1 + static_cast<uint32_t>(mesh->cMrphWeights().size());
+        if (const rtSKELE3D* skele = scene.nGetComp<rtSKELE3D>(h)) comps += 1 + static_cast<uint32_t>(skele->localPoses().size());
+        if (const rtSCRIPT* script = scene.nGetComp<rtSCRIPT>(h)) comps += 1 + static_cast<uint32_t>(script->vars.size());
+    }
+    return comps;
+}
+
+int roundTrip(Resources& rs, const std::string& dir) {
+    Scene scene;
+    scene.init(rs.res());
+    build(scene, rs, 2000, 5);
+
+    const std::string a = dir + "snapshotTest_a.ascn";
+    const std::string b = dir + "snapshotTest_b.ascn";
+    if (!scene.save(a)) { std::printf("save failed\n"); return 1; }
+
+    Scene loaded;
+    loaded.init(rs.res());
+    Asc::Handle root = loaded.load(a);
+    if (!root || !loaded.rootShift() || loaded.rootHandle() != root) { std::printf("load failed\n"); return 1; }
+
+    if (scene.nQueue(scene.rootHandle()).size() != loaded.nQueue(root).size()) {
+        std::printf("loaded %zu nodes, saved %zu\n", loaded.nQueue(root).size(), scene.nQueue(scene.rootHandle()).size());
+        return 1;
+    }
+
+    if (!loaded.save(b)) { std::printf("resave failed\n"); return 1; }
+
+    Bytes first, second;
+    if (!readFile(a, first) || !readFile(b, second)) { std::printf("can't read the saves back\n"); return 1; }
+    if (first != second) {
+        size_t at = 0;
+        while (at < first.size() && at < second.size() && first[at] == second[at]) ++at;
+        std::printf("resave differs at byte %zu (%zu vs %zu bytes)\n", at, first.size(), second.size());
+        return 1;
+    }
+
+    std::printf("round trip: %zu bytes, identical\n", first.size());
+    return 0;
+}
+
+// Corrupt a copy of the file one way or another. Most also fix up header.size so the
+// damage gets past the first check and into the section and record validation
+void corrupt(Bytes& bytes, std::mt19937& rng) {
+    using Snapshot::Header;
+    const size_t body = bytes.size() - sizeof(Header);
+
+    auto u32At = [&](size_t at, uint32_t v) { if (at + 4 <= bytes.size()) std::memcpy(bytes.data() + at, &v, 4); };
+    auto u64At = [&](size_t at, uint64_t v) { if (at + 8 <= bytes.size()) std::memcpy(bytes.data() + at, &v, 8); };
+
+    const uint32_t edges[] = { 0, 1, 2, 0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFEu, 0xFFFFFFFFu,
+                               static_cast<uint32_t>(bytes.size()), static_cast<uint32_t>(bytes.size() / 4) };
+
+    switch (rng() % 6) {
+        case 0: // Bit flips anywhere past the header
+            for (uint32_t k = 1 + rng() % 8; k > 0; --k) bytes[sizeof(Header) + rng() % body] ^= uint8_t(1u << (rng() % 8));
+            break;
+        case 1: // Edge values over aligned words, record fields are all 4-byte
+            for (uint32_t k = 1 + rng() % 4; k > 0; --k) u32At(sizeof(Header) + (rng() % body & ~size_t(3)), edges[rng() % 9]);
+            break;
+        case 2: { // A section's offset or count
+            size_t sec = offsetof(Header, secs) + (rng() % Snapshot::SecCount) * sizeof(Snapshot::Section);
+            uint64_t v = rng() % 2 ? uint64_t(edges[rng() % 9]) : (uint64_t(1) << 63) + rng() % 16;
+            u64At(sec + (rng() % 2 ? offsetof(Snapshot::Section, count) : offsetof(Snapshot::Section, offset)), v);
+            break;
+        }
+        case 3: // Truncated
+            bytes.resize(rng() % bytes.size());
+            break;
+        case 4: // Grown, junk after the last section
+            bytes.resize(bytes.size() + 1 + rng() % 64, uint8_t(rng()));
+            break;
+        default: // Header bits too
+            for (uint32_t k = 1 + rng() % 4; k > 0; --k) bytes[rng() % bytes.size()] ^= uint8_t(1u << (rng() % 8));
+            break;
+    }
+
+    if (bytes.size() >= sizeof(Header) && rng() % 4) u64At(offsetof(Header, size), bytes.size());
+}
+
+int fuzz(Resources& rs, const std::string& dir, uint32_t rounds) {
+    Scene source;
+    source.init(rs.res());
+    build(source, rs, 300, 9);
+
+    const std::string clean = dir + "snapshotTest_fuzz.ascn";
+    const std::string bad = dir + "snapshotTest_bad.ascn";
+    const std::string again = dir + "snapshotTest_again.ascn";
+
+    Bytes original;
+    if (!source.save(clean) || !readFile(clean, original)) { std::printf("fuzz: save failed\n"); return 1; }
+
+    std::mt19937 rng(77);
+    uint32_t accepted = 0;
+
+    for (uint32_t r = 0; r < rounds; ++r) {
+        Bytes bytes = original;
+        corrupt(bytes, rng);
+        if (!writeFile(bad, bytes)) { std::printf("fuzz: can't write\n"); return 1; }
+
+        Scene scene;
+        scene.init(rs.res());
+        Asc::Handle root = scene.load(bad);
+        if (!root) continue;
+        ++accepted;
+
+        // Whatever got in is a real tree: it walks, saves, and loads again to the same shape
+        walk(scene, root);
+
+        if (!scene.rootShift() || !scene.save(again)) { std::printf("fuzz round %u: accepted file doesn't save\n", r); return 1; }
+
+        Scene reloaded;
+        reloaded.init(rs.res());
+        Asc::Handle root2 = reloaded.load(again);
+        if (!root2 || reloaded.nQueue(root2).size() != scene.nQueue(root).size()) {
+            std::printf("fuzz round %u: resave of an accepted file doesn't load back\n", r);
+            return 1;
+        }
+    }
+
+    // Not there at all
+    Scene scene;
+    scene.init(rs.res());
+    if (scene.load(dir + "snapshotTest_missing.ascn")) { std::printf("fuzz: loaded a missing file\n"); return 1; }
+
+    std::printf("fuzz: %u rounds, %u corrupted files accepted\n", rounds, accepted);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t rounds = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 3000;
+    const std::string dir = argc > 2 ? std::string(argv[2]) + "/" : std::string();
+
+    Resources rs;
+    if (roundTrip(rs, dir)) return 1;
+    if (fuzz(rs, dir, rounds)) return 1;
+
+    std::printf("ok\n");
+    return 0;
+}